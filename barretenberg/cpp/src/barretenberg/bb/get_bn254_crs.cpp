@@ -1,7 +1,14 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <atomic>
 
 namespace {
+
+using namespace bb;
+
 std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
 {
     size_t g1_end = num_points * 64 - 1;
@@ -27,10 +34,62 @@ std::vector<uint8_t> download_bn254_g2_data()
     std::string command = "curl -s '" + url + "'";
     return exec_pipe(command);
 }
+
+/**
+ * @brief Stream `num_points` points from a flat g1 file directly into a pippenger point table
+ *
+ * @details The file is split into chunks, each read and decoded by a separate worker. Disk reads of one chunk thus
+ * overlap with the decoding of others, and only one chunk buffer per thread is live at a time rather than a copy of
+ * the whole file.
+ */
+void read_bn254_g1_point_table(std::string const& g1_path,
+                               g1::affine_element* point_table,
+                               size_t num_points,
+                               bool verify_points)
+{
+    constexpr size_t POINTS_PER_CHUNK = 1 << 14;
+    const size_t num_chunks = (num_points + POINTS_PER_CHUNK - 1) / POINTS_PER_CHUNK;
+
+    std::atomic<bool> read_failed = false;
+    std::atomic<bool> all_on_curve = true;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * POINTS_PER_CHUNK;
+        const size_t num_chunk_points = std::min(POINTS_PER_CHUNK, num_points - start);
+
+        std::vector<uint8_t> buffer(num_chunk_points * 64);
+        std::ifstream file(g1_path, std::ios::binary);
+        file.seekg((std::streamoff)(start * 64));
+        file.read(reinterpret_cast<char*>(buffer.data()), (std::streamsize)buffer.size());
+        if (!file) {
+            read_failed = true;
+            return;
+        }
+
+        std::vector<g1::affine_element> points(num_chunk_points);
+        for (size_t i = 0; i < num_chunk_points; ++i) {
+            points[i] = from_buffer<g1::affine_element>(buffer, i * 64);
+        }
+        if (verify_points &&
+            !std::all_of(points.begin(), points.end(), [](auto& point) { return point.on_curve(); })) {
+            all_on_curve = false;
+        }
+        scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+            points.data(), &point_table[start * 2], num_chunk_points);
+    });
+
+    if (read_failed) {
+        throw std::runtime_error("Failed to read g1 data from " + g1_path);
+    }
+    if (!all_on_curve) {
+        throw std::runtime_error("g1 data at " + g1_path + " contains points that are not on the curve.");
+    }
+}
 } // namespace
 
 namespace bb {
-std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points)
+std::shared_ptr<g1::affine_element[]> get_bn254_g1_data(const std::filesystem::path& path,
+                                                        size_t num_points,
+                                                        bool verify_points)
 {
     std::filesystem::create_directories(path);
 
@@ -39,23 +98,15 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
 
     if (g1_file_size >= num_points * 64 && g1_file_size % 64 == 0) {
         vinfo("using cached crs of size ", std::to_string(g1_file_size / 64), " at ", g1_path);
-        auto data = read_file(g1_path, g1_file_size);
-        auto points = std::vector<g1::affine_element>(num_points);
-        for (size_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<g1::affine_element>(data, i * 64);
-        }
-        return points;
+    } else {
+        vinfo("downloading crs...");
+        auto data = download_bn254_g1_data(num_points);
+        write_file(g1_path, data);
     }
 
-    vinfo("downloading crs...");
-    auto data = download_bn254_g1_data(num_points);
-    write_file(g1_path, data);
-
-    auto points = std::vector<g1::affine_element>(num_points);
-    for (size_t i = 0; i < num_points; ++i) {
-        points[i] = from_buffer<g1::affine_element>(data, i * 64);
-    }
-    return points;
+    auto point_table = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    read_bn254_g1_point_table(g1_path, point_table.get(), num_points, verify_points);
+    return point_table;
 }
 
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
@@ -9,6 +9,14 @@
 #include <ios>
 
 namespace bb {
-std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
+/**
+ * @brief Load (downloading if needed) the first `num_points` bn254 g1 points as a pippenger point table, i.e. in the
+ * form produced by generate_pippenger_point_table, ready to be handed to the crs factory.
+ *
+ * @param verify_points Also check, in parallel, that every loaded point is on the curve.
+ */
+std::shared_ptr<g1::affine_element[]> get_bn254_g1_data(const std::filesystem::path& path,
+                                                        size_t num_points,
+                                                        bool verify_points = false);
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
 } // namespace bb
\ No newline at end of file
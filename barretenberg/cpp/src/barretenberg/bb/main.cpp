@@ -1,5 +1,6 @@
 #include "barretenberg/bb/file_io.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/dsl/types.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
@@ -11,13 +12,19 @@
 #include "log.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
+#include <barretenberg/common/slab_allocator.hpp>
 #include <barretenberg/common/timer.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/dsl/acir_proofs/goblin_acir_composer.hpp>
+#include <barretenberg/serialize/cbind.hpp>
+#include <barretenberg/srs/factories/point_table_cache.hpp>
 #include <barretenberg/srs/global_crs.hpp>
 #include <cstdint>
+#include <iomanip>
 #include <iostream>
+#include <map>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -32,10 +39,43 @@ std::string getHomeDir()
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 bool verbose = false;
+bool verify_crs = false;
+bool use_point_table_cache = false;
+std::string pk_cache_path;
+// Number of g1 points held by the global crs factory. Lets repeated jobs in server mode skip reloading the crs.
+size_t bn254_crs_num_points = 0;
 
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
+/**
+ * @brief Load the first num_points bn254 g1 points as a pippenger point table
+ * @details With --point_table_cache, the table is memory mapped from a file next to the crs, which is written on first
+ * use and rebuilt whenever the g1 transcript changes. The points of a mapped table are not checked by --verify_crs.
+ */
+std::shared_ptr<g1::affine_element[]> get_bn254_point_table(size_t num_points)
+{
+    if (!use_point_table_cache) {
+        return get_bn254_g1_data(CRS_PATH, num_points, verify_crs);
+    }
+    using PointTableCache = srs::PointTableCache<curve::BN254>;
+    const std::string g1_path = CRS_PATH + "/bn254_g1.dat";
+    const std::string cache_path = CRS_PATH + "/bn254_g1_point_table.dat";
+    if (!verify_crs) {
+        const uint64_t source_hash = PointTableCache::hash_source({ g1_path });
+        if (auto point_table = PointTableCache::map(cache_path, num_points, source_hash)) {
+            return point_table;
+        }
+    }
+    // Loading the points downloads the transcript if needed, so it is only hashed afterwards
+    auto point_table = get_bn254_g1_data(CRS_PATH, num_points, verify_crs);
+    const uint64_t source_hash = PointTableCache::hash_source({ g1_path });
+    if (!PointTableCache::write(cache_path, point_table.get(), num_points, source_hash)) {
+        vinfo("could not write pippenger point table cache to ", cache_path);
+    }
+    return point_table;
+}
+
 /**
  * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
  *
@@ -44,9 +84,33 @@ const auto current_dir = current_path.filename().string();
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    const size_t num_points = dyadic_circuit_size + 1;
+    if (num_points <= bn254_crs_num_points) {
+        return;
+    }
+    auto bn254_g1_data = get_bn254_point_table(num_points);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory(bn254_g1_data, num_points, bn254_g2_data);
+    bn254_crs_num_points = num_points;
+}
+
+/**
+ * @brief Compute the proving key of the circuit built by acir_composer from the bytecode at bytecode_path
+ * @details With --pk_cache <dir>, keys are stored in dir under the bb version and the sha256 of the bytecode file, so
+ * later runs on unchanged bytecode load the key instead of preprocessing the circuit again.
+ */
+std::shared_ptr<plonk::proving_key> init_proving_key(acir_proofs::AcirComposer& acir_composer,
+                                                     const std::string& bytecode_path)
+{
+    if (pk_cache_path.empty()) {
+        return acir_composer.init_proving_key();
+    }
+    std::ostringstream key_dir;
+    key_dir << pk_cache_path << "/" << BB_VERSION << "/" << std::hex << std::setfill('0');
+    for (auto byte : crypto::sha256(read_file(bytecode_path))) {
+        key_dir << std::setw(2) << static_cast<int>(byte);
+    }
+    return acir_composer.init_proving_key(key_dir.str());
 }
 
 /**
@@ -66,8 +130,11 @@ void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 acir_proofs::AcirComposer verifier_init()
 {
     acir_proofs::AcirComposer acir_composer(0, verbose);
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    // A crs loaded by an earlier job in server mode already holds g2, don't replace it with a g1-less one.
+    if (bn254_crs_num_points == 0) {
+        auto g2_data = get_bn254_g2_data(CRS_PATH);
+        srs::init_crs_factory({}, g2_data);
+    }
     return acir_composer;
 }
 
@@ -107,7 +174,7 @@ bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessP
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
 
     Timer pk_timer;
-    acir_composer.init_proving_key();
+    init_proving_key(acir_composer, bytecodePath);
     write_benchmark("pk_construction_time", pk_timer.milliseconds(), "acir_test", current_dir);
 
     write_benchmark("gate_count", acir_composer.get_total_circuit_size(), "acir_test", current_dir);
@@ -223,7 +290,7 @@ void prove(const std::string& bytecodePath, const std::string& witnessPath, cons
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
     acir_composer.create_circuit(constraint_system, witness);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
-    acir_composer.init_proving_key();
+    init_proving_key(acir_composer, bytecodePath);
     auto proof = acir_composer.create_proof();
 
     if (outputPath == "-") {
@@ -297,7 +364,7 @@ void write_vk(const std::string& bytecodePath, const std::string& outputPath)
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
     acir_composer.create_circuit(constraint_system);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
-    acir_composer.init_proving_key();
+    init_proving_key(acir_composer, bytecodePath);
     auto vk = acir_composer.init_verification_key();
     auto serialized_vk = to_buffer(*vk);
     if (outputPath == "-") {
@@ -461,6 +528,143 @@ void acvm_info(const std::string& output_path)
     }
 }
 
+/**
+ * @brief A job for `bb server`. Paths have the same meaning as the corresponding command line options.
+ */
+struct ServerRequest {
+    // One of "prove", "verify" or "write_vk".
+    std::string command;
+    std::string bytecode_path;
+    std::string witness_path;
+    std::string proof_path;
+    std::string vk_path;
+    MSGPACK_FIELDS(command, bytecode_path, witness_path, proof_path, vk_path);
+};
+
+struct ServerResponse {
+    // Empty if the job succeeded.
+    std::string error;
+    // The proof for "prove", the serialized verification key for "write_vk".
+    std::vector<uint8_t> data;
+    // The result of "verify".
+    bool verified = false;
+    MSGPACK_FIELDS(error, data, verified);
+};
+
+/**
+ * @brief Circuit state that `bb server` keeps between jobs, keyed by the hash of the (gzipped) bytecode file
+ */
+struct ServerCircuit {
+    acir_format::AcirFormat constraint_system;
+    std::shared_ptr<plonk::proving_key> proving_key;
+    std::shared_ptr<plonk::verification_key> verification_key;
+};
+
+ServerCircuit& get_server_circuit(std::map<crypto::Sha256Hash, ServerCircuit>& circuits,
+                                  const std::string& bytecode_path)
+{
+    auto hash = crypto::sha256(read_file(bytecode_path));
+    auto it = circuits.find(hash);
+    if (it == circuits.end()) {
+        it = circuits.emplace(hash, ServerCircuit{ get_constraint_system(bytecode_path), nullptr, nullptr }).first;
+    }
+    return it->second;
+}
+
+/**
+ * @brief Build a composer for `circuit` with its proving key, which is only computed by the first job on the circuit
+ */
+acir_proofs::AcirComposer server_composer(ServerCircuit& circuit,
+                                          const std::string& bytecode_path,
+                                          const std::string& witness_path)
+{
+    acir_proofs::AcirComposer acir_composer{ 0, verbose };
+    if (witness_path.empty()) {
+        acir_composer.create_circuit(circuit.constraint_system);
+    } else {
+        acir_composer.create_circuit(circuit.constraint_system, get_witness(witness_path));
+    }
+    init_bn254_crs(acir_composer.get_dyadic_circuit_size());
+
+    if (circuit.proving_key) {
+        vinfo("using cached proving key");
+        acir_composer.set_proving_key(circuit.proving_key);
+    } else {
+        circuit.proving_key = init_proving_key(acir_composer, bytecode_path);
+    }
+    return acir_composer;
+}
+
+ServerResponse server_execute(std::map<crypto::Sha256Hash, ServerCircuit>& circuits, ServerRequest const& request)
+{
+    ServerResponse response;
+    if (request.command == "prove") {
+        auto& circuit = get_server_circuit(circuits, request.bytecode_path);
+        auto acir_composer = server_composer(circuit, request.bytecode_path, request.witness_path);
+        response.data = acir_composer.create_proof();
+    } else if (request.command == "write_vk") {
+        auto& circuit = get_server_circuit(circuits, request.bytecode_path);
+        if (!circuit.verification_key) {
+            auto acir_composer = server_composer(circuit, request.bytecode_path, "");
+            circuit.verification_key = acir_composer.init_verification_key();
+        }
+        response.data = to_buffer(*circuit.verification_key);
+    } else if (request.command == "verify") {
+        auto acir_composer = verifier_init();
+        auto vk_data = from_buffer<plonk::verification_key_data>(read_file(request.vk_path));
+        acir_composer.load_verification_key(std::move(vk_data));
+        response.verified = acir_composer.verify_proof(read_file(request.proof_path));
+    } else {
+        response.error = "Unknown command: " + request.command;
+    }
+    return response;
+}
+
+/**
+ * @brief Runs bb as a long lived prover process
+ *
+ * @details Jobs are read from stdin and answered on stdout, in order, as messages made of a 4 byte big-endian length
+ * followed by that many bytes of msgpack: a ServerRequest map for jobs and a ServerResponse map for answers. The crs,
+ * thread pool and plookup tables are initialized once, and the constraint system and keys of every circuit are kept
+ * in memory, so repeated jobs on the same circuit only pay for witness-dependent work. Exits when stdin is closed.
+ *
+ * Communication:
+ * - stdin: The stream of jobs
+ * - stdout: The stream of responses
+ */
+void server()
+{
+    std::map<crypto::Sha256Hash, ServerCircuit> circuits;
+
+    uint32_t length = 0;
+    while (std::cin.read(reinterpret_cast<char*>(&length), sizeof(length))) {
+        std::vector<char> request_buffer(ntohl(length));
+        if (!std::cin.read(request_buffer.data(), (std::streamsize)request_buffer.size())) {
+            throw std::runtime_error("Truncated server request.");
+        }
+
+        ServerResponse response;
+        try {
+            ServerRequest request;
+            msgpack::unpack(request_buffer.data(), request_buffer.size()).get().convert(request);
+            vinfo("server job: ", request.command);
+            // Release the slabs cached during each job, so the size classes of one circuit are not kept for the next
+            SlabCacheFlushGuard flush_guard;
+            response = server_execute(circuits, request);
+            vinfo("server job peak slab memory: ", get_slab_allocator_stats().peak_bytes_in_use);
+        } catch (std::exception const& err) {
+            response.error = err.what();
+        }
+
+        msgpack::sbuffer response_buffer;
+        msgpack::pack(response_buffer, response);
+        uint32_t response_length = htonl(static_cast<uint32_t>(response_buffer.size()));
+        std::cout.write(reinterpret_cast<char const*>(&response_length), sizeof(response_length));
+        std::cout.write(response_buffer.data(), (std::streamsize)response_buffer.size());
+        std::cout.flush();
+    }
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -477,6 +681,9 @@ int main(int argc, char* argv[])
     try {
         std::vector<std::string> args(argv + 1, argv + argc);
         verbose = flag_present(args, "-v") || flag_present(args, "--verbose");
+        verify_crs = flag_present(args, "--verify_crs");
+        use_point_table_cache = flag_present(args, "--point_table_cache");
+        pk_cache_path = get_option(args, "--pk_cache", "");
 
         if (args.empty()) {
             std::cerr << "No command provided.\n";
@@ -502,6 +709,10 @@ int main(int argc, char* argv[])
             acvm_info(output_path);
             return 0;
         }
+        if (command == "server") {
+            server();
+            return 0;
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path) ? 0 : 1;
         }
@@ -544,7 +755,7 @@ int main(int argc, char* argv[])
                 call_data_bytes = read_file(call_data_path);
             }
 
-            srs::init_crs_factory("../srs_db/ignition");
+            srs::init_crs_factory("../srs_db/ignition", use_point_table_cache);
 
             std::vector<fr> const call_data = many_from_buffer<fr>(call_data_bytes);
             auto const avm_bytecode = read_file(avm_bytecode_path);
@@ -555,7 +766,7 @@ int main(int argc, char* argv[])
             std::cerr << "Unknown command: " << command << "\n";
             return 1;
         }
-    } catch (std::runtime_error const& err) {
+    } catch (std::exception const& err) {
         std::cerr << err.what() << std::endl;
         return 1;
     }
@@ -12,6 +12,7 @@ using Poseidon2 = AppendOnlyTree<ArrayStore, Poseidon2HashPolicy>;
 
 const size_t TREE_DEPTH = 32;
 const size_t MAX_BATCH_SIZE = 128;
+const size_t MAX_BLOCK_SIZE = 64 * 1024;
 
 namespace {
 auto& random_engine = bb::numeric::get_randomness();
@@ -51,4 +52,11 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Range(2, MAX_BATCH_SIZE)
     ->Iterations(1000);
 
+// Appending a block's worth of note commitments at a time
+BENCHMARK(append_only_tree_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1024, MAX_BLOCK_SIZE)
+    ->Iterations(8);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -135,6 +135,31 @@ BENCHMARK_DEFINE_F(GoblinBench, GoblinTranslatorProve)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark only the construction of the Translator circuit from an op queue with 2^state.range(0) operations
+ *
+ */
+void goblin_translator_circuit_construction(State& state) noexcept
+{
+    using Point = curve::BN254::AffineElement;
+    using Fq = curve::BN254::BaseField;
+    using Fr = curve::BN254::ScalarField;
+
+    const size_t num_ops = 1UL << static_cast<size_t>(state.range(0));
+    auto op_queue = std::make_shared<ECCOpQueue>();
+    auto point = Point::random_element();
+    for (size_t i = 0; i < num_ops; ++i) {
+        op_queue->mul_accumulate(point, Fr::random_element());
+    }
+    Fq batching_challenge_v = Fq::random_element();
+    Fq evaluation_input_x = Fq::random_element();
+
+    for (auto _ : state) {
+        GoblinTranslatorCircuitBuilder circuit_builder{ batching_challenge_v, evaluation_input_x, op_queue };
+        DoNotOptimize(circuit_builder);
+    }
+}
+
 #define ARGS                                                                                                           \
     Arg(GoblinBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)                                                                 \
         ->Arg(1 << 0)                                                                                                  \
@@ -149,6 +174,7 @@ BENCHMARK_REGISTER_F(GoblinBench, GoblinFull)->Unit(benchmark::kMillisecond)->AR
 BENCHMARK_REGISTER_F(GoblinBench, GoblinAccumulate)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, GoblinECCVMProve)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, GoblinTranslatorProve)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK(goblin_translator_circuit_construction)->Unit(benchmark::kMillisecond)->DenseRange(10, 16, 2);
 
 } // namespace
 
@@ -0,0 +1,56 @@
+#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using Fq = crypto::pedersen_hash::Fq;
+
+/**
+ * @brief Hash a pair of fields with the default generators, as done for every node of a Pedersen merkle tree
+ */
+void pedersen_hash_pair(State& state) noexcept
+{
+    Fq x = Fq::random_element();
+    Fq y = Fq::random_element();
+    for (auto _ : state) {
+        x = crypto::pedersen_hash::hash({ x, y });
+        DoNotOptimize(x);
+    }
+}
+
+/**
+ * @brief Hash a pair of fields with generators outside the default context, which have no fixed-base tables
+ */
+void pedersen_hash_pair_custom_context(State& state) noexcept
+{
+    const crypto::pedersen_hash::GeneratorContext context(0, "PEDERSEN_BENCH");
+    Fq x = Fq::random_element();
+    Fq y = Fq::random_element();
+    for (auto _ : state) {
+        x = crypto::pedersen_hash::hash({ x, y }, context);
+        DoNotOptimize(x);
+    }
+}
+
+/**
+ * @brief Hash 2^state.range(0) independent pairs of fields at once
+ */
+void pedersen_hash_batch(State& state) noexcept
+{
+    std::vector<std::vector<Fq>> inputs(1UL << static_cast<size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = { Fq::random_element(), Fq::random_element() };
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_batch(inputs));
+    }
+}
+} // namespace
+
+BENCHMARK(pedersen_hash_pair)->Unit(kMicrosecond);
+BENCHMARK(pedersen_hash_pair_custom_context)->Unit(kMicrosecond);
+BENCHMARK(pedersen_hash_batch)->Unit(kMillisecond)->DenseRange(10, 16, 2);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+#include "barretenberg/plonk/work_queue/work_queue.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::plonk;
+
+namespace {
+constexpr size_t NUM_WIRES = 4;
+
+/**
+ * @brief The work a Plonk round queues for its wires: the IFFT and the FFT of each wire, and the commitment to each
+ * monomial form
+ */
+struct WireRound {
+    std::shared_ptr<proving_key> key;
+    transcript::StandardTranscript transcript{ transcript::Manifest() };
+    std::vector<polynomial> scalars;
+
+    explicit WireRound(size_t n)
+    {
+        static auto file_crs = std::make_shared<srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+        key = std::make_shared<proving_key>(n, 0, file_crs->get_prover_crs(n + 1), CircuitType::ULTRA);
+        for (size_t i = 0; i < NUM_WIRES; ++i) {
+            polynomial wire_lagrange(n);
+            polynomial wire_scalars(n);
+            for (size_t j = 0; j < n; ++j) {
+                wire_lagrange[j] = fr::random_element();
+                wire_scalars[j] = fr::random_element();
+            }
+            key->polynomial_store.put("w_" + std::to_string(i + 1) + "_lagrange", std::move(wire_lagrange));
+            scalars.emplace_back(std::move(wire_scalars));
+        }
+    }
+
+    std::vector<work_queue::work_item> wire_items(size_t i)
+    {
+        const std::string tag = "w_" + std::to_string(i + 1);
+        return {
+            { .work_type = work_queue::WorkType::IFFT,
+              .mul_scalars = nullptr,
+              .tag = tag,
+              .constant = fr(0),
+              .index = 0 },
+            { .work_type = work_queue::WorkType::FFT,
+              .mul_scalars = nullptr,
+              .tag = tag,
+              .constant = fr(0),
+              .index = 0 },
+            { .work_type = work_queue::WorkType::SCALAR_MULTIPLICATION,
+              .mul_scalars = scalars[i].data(),
+              .tag = "W_" + std::to_string(i + 1),
+              .constant = fr(key->circuit_size),
+              .index = 0 },
+        };
+    }
+};
+
+/**
+ * @brief A round processed by one flush of the queue, which groups the items by type and batches the transforms
+ */
+void process_grouped_queue(State& state) noexcept
+{
+    WireRound round(static_cast<size_t>(state.range(0)));
+    work_queue queue(round.key.get(), &round.transcript);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_WIRES; ++i) {
+            for (const auto& item : round.wire_items(i)) {
+                queue.add_to_queue(item);
+            }
+        }
+        queue.process_queue();
+    }
+}
+BENCHMARK(process_grouped_queue)->RangeMultiplier(4)->Range(1 << 12, 1 << 16)->Unit(kMillisecond);
+
+/**
+ * @brief The same round with the queue flushed after every item, i.e. every item processed on its own in queue order
+ */
+void process_queue_item_by_item(State& state) noexcept
+{
+    WireRound round(static_cast<size_t>(state.range(0)));
+    work_queue queue(round.key.get(), &round.transcript);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_WIRES; ++i) {
+            for (const auto& item : round.wire_items(i)) {
+                queue.add_to_queue(item);
+                queue.process_queue();
+            }
+        }
+    }
+}
+BENCHMARK(process_queue_item_by_item)->RangeMultiplier(4)->Range(1 << 12, 1 << 16)->Unit(kMillisecond);
+} // namespace
+
+BENCHMARK_MAIN();
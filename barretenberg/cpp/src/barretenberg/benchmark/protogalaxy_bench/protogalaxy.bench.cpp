@@ -8,13 +8,11 @@ using namespace benchmark;
 
 namespace bb {
 
-// Fold one instance into an accumulator.
-template <typename Composer> void fold_one(State& state) noexcept
+// Fold NUM_INSTANCES - 1 instances into an accumulator.
+template <typename Composer, size_t NUM_INSTANCES> void fold_k(State& state) noexcept
 {
     using Flavor = typename Composer::Flavor;
     using Instance = ProverInstance_<Flavor>;
-    using Instances = ProverInstances_<Flavor, 2>;
-    using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
     using Builder = typename Flavor::CircuitBuilder;
 
     bb::srs::init_crs_factory("../srs_db/ignition");
@@ -33,18 +31,28 @@ template <typename Composer> void fold_one(State& state) noexcept
         return composer.create_instance(builder);
     };
 
-    std::shared_ptr<Instance> instance_1 = construct_instance();
-    std::shared_ptr<Instance> instance_2 = construct_instance();
+    std::vector<std::shared_ptr<Instance>> instances;
+    for (size_t idx = 0; idx < NUM_INSTANCES; idx++) {
+        instances.emplace_back(construct_instance());
+    }
 
-    ProtoGalaxyProver folding_prover = composer.create_folding_prover({ instance_1, instance_2 });
+    auto folding_prover = composer.template create_folding_prover<NUM_INSTANCES>(instances);
 
     for (auto _ : state) {
         auto proof = folding_prover.fold_instances();
     }
+    // Report the number of instances folded per second, to compare the cost per instance across values of k
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_INSTANCES - 1));
 }
 
-BENCHMARK(fold_one<UltraComposer>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
-BENCHMARK(fold_one<GoblinUltraComposer>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 2>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraComposer, 2>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 4>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraComposer, 4>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 8>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraComposer, 8>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraComposer, 16>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraComposer, 16>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
 } // namespace bb
 
 BENCHMARK_MAIN();
@@ -0,0 +1,50 @@
+#include "barretenberg/flavor/goblin_translator.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
+#include "barretenberg/proof_system/library/grand_product_library.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+}
+
+namespace bb::benchmark::relations {
+
+/**
+ * @brief Compute the grand product of GrandProdRelation over 2^state.range(0) rows
+ * @details Only the entities read by the relation and the grand product polynomial itself are allocated, the others
+ * are left empty, which is also what the computation now reads.
+ */
+template <typename Flavor, typename GrandProdRelation> void compute_grand_product(State& state) noexcept
+{
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    const size_t circuit_size = 1UL << static_cast<size_t>(state.range(0));
+
+    typename Flavor::ProverPolynomials polynomials;
+    for (auto& polynomial : GrandProdRelation::get_grand_product_entities(polynomials)) {
+        polynomial = Polynomial(circuit_size);
+        for (size_t i = 0; i < circuit_size; ++i) {
+            polynomial[i] = FF::random_element(&engine);
+        }
+    }
+    GrandProdRelation::get_grand_product_polynomial(polynomials) = Polynomial(circuit_size);
+    auto relation_parameters = RelationParameters<FF>::get_random();
+
+    for (auto _ : state) {
+        bb::compute_grand_product<Flavor, GrandProdRelation>(circuit_size, polynomials, relation_parameters);
+    }
+}
+
+BENCHMARK(compute_grand_product<GoblinUltraFlavor, UltraPermutationRelation<fr>>)
+    ->DenseRange(16, 20, 2)
+    ->Unit(kMillisecond);
+BENCHMARK(compute_grand_product<GoblinUltraFlavor, LookupRelation<fr>>)->DenseRange(16, 20, 2)->Unit(kMillisecond);
+BENCHMARK(compute_grand_product<GoblinTranslatorFlavor, GoblinTranslatorPermutationRelation<fr>>)
+    ->DenseRange(16, 20, 2)
+    ->Unit(kMillisecond);
+
+} // namespace bb::benchmark::relations
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+#include "barretenberg/flavor/generated/avm_flavor.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/relations/generated/avm/equiv_tag_err.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+}
+
+namespace bb::benchmark::relations {
+
+/**
+ * @brief Fill the polynomials with random values, setting every fourth entry of the entities in `enablers` to one and
+ * the rest to zero, so that a quarter of the rows need an inverse
+ */
+template <typename Flavor, typename ProverPolynomials>
+void randomize(ProverPolynomials& polynomials, const size_t num_rows, const auto& enablers)
+{
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = Polynomial(num_rows);
+        for (size_t i = 0; i < num_rows; ++i) {
+            polynomial[i] = FF::random_element(&engine);
+        }
+    }
+    for (auto& enabler : enablers(polynomials)) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            enabler.get()[i] = (i % 4 == 0) ? 1 : 0;
+        }
+    }
+}
+
+/**
+ * @brief The GoblinUltra databus lookup; its rows are fetched in full
+ */
+void compute_databus_inverse(State& state) noexcept
+{
+    using Flavor = GoblinUltraFlavor;
+    using FF = typename Flavor::FF;
+
+    const size_t num_rows = 1 << state.range(0);
+    typename Flavor::ProverPolynomials polynomials;
+    randomize<Flavor>(polynomials, num_rows, [](auto& polys) {
+        return std::array{ std::ref(polys.q_busread), std::ref(polys.calldata_read_counts) };
+    });
+    auto params = bb::RelationParameters<FF>::get_random();
+
+    for (auto _ : state) {
+        compute_logderivative_inverse<Flavor, typename Flavor::LogDerivLookupRelation>(polynomials, params, num_rows);
+    }
+}
+BENCHMARK(compute_databus_inverse)->DenseRange(14, 20, 2)->Unit(kMillisecond);
+
+/**
+ * @brief An AVM generic lookup; only the entities it declares are read from each row
+ */
+void compute_avm_lookup_inverse(State& state) noexcept
+{
+    using Flavor = AvmFlavor;
+    using FF = typename Flavor::FF;
+
+    const size_t num_rows = 1 << state.range(0);
+    typename Flavor::ProverPolynomials polynomials;
+    randomize<Flavor>(polynomials, num_rows, [](auto& polys) {
+        return std::array{ std::ref(polys.avm_mem_m_tag_err), std::ref(polys.avm_main_tag_err) };
+    });
+    auto params = bb::RelationParameters<FF>::get_random();
+
+    for (auto _ : state) {
+        compute_logderivative_inverse<Flavor, equiv_tag_err_relation<FF>>(polynomials, params, num_rows);
+    }
+}
+BENCHMARK(compute_avm_lookup_inverse)->DenseRange(14, 20, 2)->Unit(kMillisecond);
+
+} // namespace bb::benchmark::relations
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include "barretenberg/flavor/ultra.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+}
+
+namespace bb::benchmark::relations {
+
+using Flavor = UltraFlavor;
+using FF = typename Flavor::FF;
+using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+/**
+ * @brief The trace layouts the round univariate is computed on
+ * @details In DENSE every gated relation is active on every row, so that no relation can be skipped. In ACIR, every
+ * row holds one gate type drawn with frequencies roughly matching the execution traces of Noir programs: mostly
+ * arithmetic, a fair share of lookups and memory (auxiliary) gates, a few range constraints and very few elliptic
+ * gates. Comparing the two shows the work saved by skipping relations whose selector vanishes.
+ */
+enum class TraceDistribution { DENSE, ACIR };
+
+ProverPolynomials construct_polynomials(size_t circuit_size, TraceDistribution distribution)
+{
+    ProverPolynomials polynomials;
+    for (auto& poly : polynomials.get_all()) {
+        poly = Polynomial<FF>(circuit_size);
+        for (auto& coeff : poly) {
+            coeff = FF::random_element(&engine);
+        }
+    }
+    if (distribution == TraceDistribution::DENSE) {
+        return polynomials;
+    }
+
+    auto selectors = RefArray{ polynomials.q_arith,
+                               polynomials.q_lookup,
+                               polynomials.q_aux,
+                               polynomials.q_sort,
+                               polynomials.q_elliptic };
+    // Cumulative percentages of rows holding each of the gate types above
+    const std::array<uint32_t, 5> cumulative_frequencies{ 60, 80, 92, 99, 100 };
+    for (size_t i = 0; i < circuit_size; ++i) {
+        const uint32_t draw = engine.get_random_uint32() % 100;
+        size_t gate_type = 0;
+        while (draw >= cumulative_frequencies[gate_type]) {
+            ++gate_type;
+        }
+        for (size_t j = 0; j < selectors.size(); ++j) {
+            selectors[j][i] = j == gate_type ? FF(1) : FF(0);
+        }
+    }
+    return polynomials;
+}
+
+/**
+ * @brief Compute the univariate of the first sumcheck round for an Ultra trace of 2^state.range(0) rows
+ */
+template <TraceDistribution distribution> void compute_round_univariate(::benchmark::State& state)
+{
+    const size_t circuit_size = 1UL << static_cast<size_t>(state.range(0));
+    const size_t log_circuit_size = static_cast<size_t>(state.range(0));
+
+    auto polynomials = construct_polynomials(circuit_size, distribution);
+    auto relation_parameters = bb::RelationParameters<FF>::get_random();
+    typename Flavor::RelationSeparator alpha;
+    for (auto& challenge : alpha) {
+        challenge = FF::random_element(&engine);
+    }
+    std::vector<FF> gate_challenges(log_circuit_size);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element(&engine);
+    }
+    bb::PowPolynomial<FF> pow_polynomial(gate_challenges);
+    pow_polynomial.compute_values();
+
+    for (auto _ : state) {
+        SumcheckProverRound<Flavor> round(circuit_size);
+        DoNotOptimize(round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha));
+    }
+}
+
+BENCHMARK(compute_round_univariate<TraceDistribution::DENSE>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(compute_round_univariate<TraceDistribution::ACIR>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+
+} // namespace bb::benchmark::relations
+
+BENCHMARK_MAIN();
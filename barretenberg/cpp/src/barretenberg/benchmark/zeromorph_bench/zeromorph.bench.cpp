@@ -0,0 +1,70 @@
+#include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using Curve = curve::BN254;
+using Fr = Curve::ScalarField;
+using ZeroMorphProver = ZeroMorphProver_<Curve>;
+
+constexpr size_t MIN_LOG_CIRCUIT_SIZE = 12;
+constexpr size_t MAX_LOG_CIRCUIT_SIZE = 18;
+// Roughly the number of unshifted and to-be-shifted polynomials opened by the Ultra Honk prover
+constexpr size_t NUM_UNSHIFTED = 40;
+constexpr size_t NUM_SHIFTED = 10;
+
+/**
+ * @brief Run the ZeroMorph prover on a batch of NUM_UNSHIFTED random multilinear polynomials of size 2^state.range(0),
+ * of which the first NUM_SHIFTED are also opened shifted, as at the end of the Ultra Honk prover
+ */
+void zeromorph_prove(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const auto log_n = static_cast<size_t>(state.range(0));
+    const size_t n = 1UL << log_n;
+
+    auto commitment_key = std::make_shared<CommitmentKey<Curve>>(n, srs::get_crs_factory());
+
+    std::vector<Polynomial<Fr>> f_polynomials;
+    std::vector<Fr> f_evaluations;
+    for (size_t i = 0; i < NUM_UNSHIFTED; ++i) {
+        Polynomial<Fr> polynomial(n);
+        // Start at 1 so that the polynomials are shiftable
+        for (size_t j = 1; j < n; ++j) {
+            polynomial[j] = Fr::random_element(&engine);
+        }
+        f_polynomials.emplace_back(std::move(polynomial));
+        f_evaluations.emplace_back(Fr::random_element(&engine));
+    }
+    std::vector<Polynomial<Fr>> g_polynomials;
+    std::vector<Fr> g_shift_evaluations;
+    for (size_t i = 0; i < NUM_SHIFTED; ++i) {
+        g_polynomials.emplace_back(f_polynomials[i].share());
+        g_shift_evaluations.emplace_back(Fr::random_element(&engine));
+    }
+    std::vector<Fr> multilinear_challenge(log_n);
+    for (auto& challenge : multilinear_challenge) {
+        challenge = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        auto transcript = std::make_shared<NativeTranscript>();
+        ZeroMorphProver::prove(RefVector(f_polynomials),
+                               RefVector(g_polynomials),
+                               RefVector(f_evaluations),
+                               RefVector(g_shift_evaluations),
+                               multilinear_challenge,
+                               commitment_key,
+                               transcript);
+    }
+}
+} // namespace
+
+BENCHMARK(zeromorph_prove)->Unit(kMillisecond)->DenseRange(MIN_LOG_CIRCUIT_SIZE, MAX_LOG_CIRCUIT_SIZE, 2);
+
+BENCHMARK_MAIN();
@@ -34,6 +34,47 @@ template <typename Curve> void bench_commit(::benchmark::State& state)
 
 BENCHMARK(bench_commit<curve::BN254>)->DenseRange(10, MAX_LOG_NUM_POINTS)->Unit(benchmark::kMillisecond);
 
+// Commit to a batch of polynomials of equal size, one at a time and through commit_batch
+constexpr size_t NUM_BATCH_POLYNOMIALS = 8;
+
+template <typename Curve> void bench_commit_sequential(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t k = 0; k < NUM_BATCH_POLYNOMIALS; ++k) {
+        polynomials.emplace_back(num_points);
+        for (auto& coeff : polynomials.back()) {
+            coeff = Fr::random_element();
+        }
+    }
+    for (auto _ : state) {
+        for (auto& polynomial : polynomials) {
+            benchmark::DoNotOptimize(key->commit(polynomial));
+        }
+    }
+}
+
+template <typename Curve> void bench_commit_batch(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t k = 0; k < NUM_BATCH_POLYNOMIALS; ++k) {
+        polynomials.emplace_back(num_points);
+        for (auto& coeff : polynomials.back()) {
+            coeff = Fr::random_element();
+        }
+    }
+    std::vector<std::span<const Fr>> spans(polynomials.begin(), polynomials.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit_batch(spans));
+    }
+}
+
+BENCHMARK(bench_commit_sequential<curve::BN254>)->DenseRange(2, 20, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_batch<curve::BN254>)->DenseRange(2, 20, 2)->Unit(benchmark::kMillisecond);
+
 } // namespace bb
 
 BENCHMARK_MAIN();
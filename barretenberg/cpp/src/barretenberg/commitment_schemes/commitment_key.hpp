@@ -8,6 +8,7 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -16,9 +17,12 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -60,6 +64,10 @@ template <class Curve> class CommitmentKey {
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
+     * @details The coefficients are scanned first, so that polynomials which are mostly zero or only hold small values
+     * (e.g. the Goblin ECC op wires and DataBus columns) take a cheaper path than full width pippenger. See
+     * scalar_multiplication::pippenger_unsafe_sparse_aware.
+     *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
      */
@@ -68,10 +76,71 @@ template <class Curve> class CommitmentKey {
         BB_OP_COUNT_TIME();
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
-        return bb::scalar_multiplication::pippenger_unsafe<Curve>(
+        return bb::scalar_multiplication::pippenger_unsafe_sparse_aware<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Commit to several polynomials at once, sharing the pippenger runtime state between them
+     *
+     * @details Polynomials large enough for pippenger are committed one after the other, since each of those MSMs
+     * already spreads its rounds across every thread. Polynomials below the pippenger threshold would otherwise each
+     * run a short parallel_for over a handful of points, so their scalar multiplications are flattened into a single
+     * parallel loop over the points of all of them.
+     *
+     * @param polynomials univariate polynomials p_k(X) = ∑ᵢ aₖᵢ⋅Xⁱ
+     * @return Commitments C_k = [p_k(x)], in the order of the input polynomials
+     */
+    std::vector<Commitment> commit_batch(std::span<const std::span<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        using Element = typename Curve::Element;
+
+        const size_t threshold = get_num_cpus_pow2() * 8;
+        std::vector<Element> results(polynomials.size());
+        // Polynomials committed by the flattened loop, and the offset of each of their first terms
+        std::vector<size_t> small_polynomials;
+        std::vector<size_t> term_offsets{ 0 };
+        for (size_t k = 0; k < polynomials.size(); ++k) {
+            const size_t degree = polynomials[k].size();
+            ASSERT(degree <= srs->get_monomial_size());
+            if (degree <= threshold) {
+                small_polynomials.push_back(k);
+                term_offsets.push_back(term_offsets.back() + degree);
+            } else {
+                results[k] = bb::scalar_multiplication::pippenger_unsafe_sparse_aware<Curve>(
+                    const_cast<Fr*>(polynomials[k].data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+            }
+        }
+
+        if (!small_polynomials.empty()) {
+            // The pippenger point table interleaves each SRS point with its endomorphism image
+            const Commitment* points = srs->get_monomial_points();
+            std::vector<Element> terms(term_offsets.back());
+            run_loop_in_parallel(terms.size(), [&](size_t start, size_t end) {
+                size_t k = static_cast<size_t>(std::upper_bound(term_offsets.begin(), term_offsets.end(), start) -
+                                               term_offsets.begin()) -
+                           1;
+                for (size_t i = start; i < end; ++i) {
+                    while (i >= term_offsets[k + 1]) {
+                        ++k;
+                    }
+                    const size_t j = i - term_offsets[k];
+                    terms[i] = Element(points[j * 2]) * polynomials[small_polynomials[k]][j];
+                }
+            });
+            for (size_t k = 0; k < small_polynomials.size(); ++k) {
+                Element& result = results[small_polynomials[k]];
+                result.self_set_infinity();
+                for (size_t i = term_offsets[k]; i < term_offsets[k + 1]; ++i) {
+                    result += terms[i];
+                }
+            }
+        }
+
+        return { results.begin(), results.end() };
+    };
+
     bb::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> srs;
 };
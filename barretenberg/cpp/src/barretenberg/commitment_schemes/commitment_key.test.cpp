@@ -0,0 +1,47 @@
+#include "commitment_key.test.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bb {
+
+template <class Curve> class CommitmentKeyTest : public CommitmentTest<Curve> {
+  public:
+    using Fr = typename Curve::ScalarField;
+    using Commitment = typename Curve::AffineElement;
+    using Polynomial = bb::Polynomial<Fr>;
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(CommitmentKeyTest, Curves);
+
+/**
+ * @brief Check that a batch commitment agrees with committing to each polynomial on its own, both for polynomials
+ * large enough for pippenger and for those below its threshold
+ */
+TYPED_TEST(CommitmentKeyTest, CommitBatchMatchesCommit)
+{
+    using Fr = typename TestFixture::Fr;
+    using Commitment = typename TestFixture::Commitment;
+    using Polynomial = typename TestFixture::Polynomial;
+
+    std::vector<Polynomial> polynomials;
+    for (const size_t n : std::vector<size_t>{ 1024, 2, 0, 17, 4096, 1 }) {
+        polynomials.emplace_back(this->random_polynomial(n));
+    }
+    // A polynomial with a zero scalar and one with only zero scalars
+    polynomials[3][5] = 0;
+    polynomials.emplace_back(8);
+
+    std::vector<std::span<const Fr>> spans(polynomials.begin(), polynomials.end());
+    std::vector<Commitment> commitments = this->ck()->commit_batch(spans);
+
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t k = 0; k < polynomials.size(); ++k) {
+        EXPECT_EQ(commitments[k], this->commit(polynomials[k])) << "polynomial " << k;
+    }
+}
+
+} // namespace bb
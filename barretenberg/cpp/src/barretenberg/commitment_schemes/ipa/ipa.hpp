@@ -4,8 +4,10 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -172,17 +174,56 @@ template <typename Curve> class IPA {
     }
 
     /**
-     * @brief Verify the correctness of a Proof
+     * @brief What remains of the verification of an IPA proof once it has been reduced to a claim about the SRS
+     * @details Writing s for the vector of products of inverse round challenges (see compute_s_vec), the proof is
+     * valid iff reduced_commitment = a_zero * <s, G>, with G the SRS. Keeping the check in this form lets the verifier
+     * defer the size-n MSM and check many such claims at once, see batch_verify.
+     */
+    struct ReducedClaim {
+        // C_zero - a_zero * b_zero * U
+        GroupElement reduced_commitment;
+        Fr a_zero;
+        std::vector<Fr> round_challenges_inv;
+    };
+
+    /**
+     * @brief Compute scalar * s, where s_i is the product of the inverse round challenges u_{k-1-j}^{-1} over the bits
+     * j set in i
+     * @details s_i only differs from s_{i - 2^j}, with j the highest bit of i, by the factor u_{k-1-j}^{-1}. So s can be
+     * built as a tree of products, level j doubling the computed prefix, with a single multiplication per element.
+     */
+    static std::vector<Fr> compute_s_vec(std::span<const Fr> round_challenges_inv, const Fr& scalar = Fr::one())
+    {
+        const size_t log_poly_degree = round_challenges_inv.size();
+        std::vector<Fr> s_vec(static_cast<size_t>(1) << log_poly_degree);
+        s_vec[0] = scalar;
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            const size_t level_size = static_cast<size_t>(1) << j;
+            const Fr& challenge_inv = round_challenges_inv[log_poly_degree - 1 - j];
+            run_loop_in_parallel_if_effective(
+                level_size,
+                [&s_vec, &challenge_inv, level_size](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        s_vec[level_size + i] = s_vec[i] * challenge_inv;
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/0,
+                /*finite_field_multiplications_per_iteration=*/1);
+        }
+        return s_vec;
+    }
+
+    /**
+     * @brief Run the verifier's side of the transcript and reduce the proof to a claim about the SRS, without
+     * computing the size-n MSM
      *
      * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
-     * @param proof The proof containg L_vec, R_vec and a_zero
-     * @param pub_input Data required to verify the proof
-     *
-     * @return true/false depending on if the proof verifies
+     * @param opening_claim The commitment and opening pair the proof is for
+     * @param transcript Verifier transcript holding the proof
      */
-    static bool verify(const std::shared_ptr<VK>& vk,
-                       const OpeningClaim<Curve>& opening_claim,
-                       const std::shared_ptr<NativeTranscript>& transcript)
+    static ReducedClaim reduce_verify(const std::shared_ptr<VK>& vk,
+                                      const OpeningClaim<Curve>& opening_claim,
+                                      const std::shared_ptr<NativeTranscript>& transcript)
     {
         auto poly_degree = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
             "IPA:poly_degree")); // note this is base field because this is a uint32_t, which should map to a bb::fr,
@@ -232,61 +273,67 @@ template <typename Curve> class IPA {
                                    opening_claim.opening_pair.challenge.pow(exponent));
         }
 
-        // Compute G_zero
-        // First construct s_vec
-        std::vector<Fr> s_vec(poly_degree);
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its O(nlogn).
-        // This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        run_loop_in_parallel_if_effective(
-            poly_degree,
-            [&s_vec, &round_challenges_inv, log_poly_degree](size_t start, size_t end) {
-                for (size_t i = start; i < end; i++) {
-                    Fr s_vec_scalar = Fr::one();
-                    for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                        auto bit = (i >> j) & 1;
-                        bool b = static_cast<bool>(bit);
-                        if (b) {
-                            s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
-                        }
-                    }
-                    s_vec[i] = s_vec_scalar;
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/log_poly_degree);
-
-        auto* srs_elements = vk->srs->get_monomial_points();
+        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
+        return { C_zero - aux_generator * (a_zero * b_zero), a_zero, std::move(round_challenges_inv) };
+    }
 
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        run_loop_in_parallel_if_effective(
-            poly_degree,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
-                for (size_t i = start * 2; i < end * 2; i += 2) {
-                    G_vec_local[i >> 1] = srs_elements[i];
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/0,
-            /*finite_field_inversions_per_iteration=*/0,
-            /*group_element_additions_per_iteration=*/0,
-            /*group_element_doublings_per_iteration=*/0,
-            /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
+    /**
+     * @brief Check a batch of reduced claims with a single MSM against the SRS
+     * @details The claims are combined with random weights r_i (r_0 = 1), and the check becomes
+     * ∑ r_i * reduced_commitment_i = <∑ r_i * a_zero_i * s_i, G>, where the s_i of smaller claims are padded with zeros.
+     * The SRS held by the verification key already is a pippenger point table, so the MSM runs on it in place.
+     */
+    static bool batch_verify(const std::shared_ptr<VK>& vk, std::span<const ReducedClaim> claims)
+    {
+        if (claims.empty()) {
+            return true;
+        }
+        size_t max_log_poly_degree = 0;
+        for (const auto& claim : claims) {
+            max_log_poly_degree = std::max(max_log_poly_degree, claim.round_challenges_inv.size());
+        }
+        const size_t poly_degree = static_cast<size_t>(1) << max_log_poly_degree;
 
-        auto G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
+        GroupElement left_hand_side = claims[0].reduced_commitment;
+        std::vector<Fr> scalars = compute_s_vec(claims[0].round_challenges_inv, claims[0].a_zero);
+        scalars.resize(poly_degree, Fr::zero());
+        for (size_t i = 1; i < claims.size(); i++) {
+            const Fr weight = Fr::random_element();
+            left_hand_side += claims[i].reduced_commitment * weight;
+            const auto s_vec = compute_s_vec(claims[i].round_challenges_inv, claims[i].a_zero * weight);
+            run_loop_in_parallel_if_effective(
+                s_vec.size(),
+                [&scalars, &s_vec](size_t start, size_t end) {
+                    for (size_t j = start; j < end; j++) {
+                        scalars[j] += s_vec[j];
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/1);
+        }
 
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        auto* srs_elements = vk->srs->get_monomial_points();
+        GroupElement right_hand_side = bb::scalar_multiplication::pippenger<Curve>(
+            &scalars[0], srs_elements, poly_degree, vk->pippenger_runtime_state, false);
 
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+        return (left_hand_side.normalize() == right_hand_side.normalize());
+    }
 
-        return (C_zero.normalize() == right_hand_side.normalize());
+    /**
+     * @brief Verify the correctness of a Proof
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param proof The proof containg L_vec, R_vec and a_zero
+     * @param pub_input Data required to verify the proof
+     *
+     * @return true/false depending on if the proof verifies
+     */
+    static bool verify(const std::shared_ptr<VK>& vk,
+                       const OpeningClaim<Curve>& opening_claim,
+                       const std::shared_ptr<NativeTranscript>& transcript)
+    {
+        const ReducedClaim claim = reduce_verify(vk, opening_claim, transcript);
+        return batch_verify(vk, std::span{ &claim, 1 });
     }
 };
 
@@ -84,6 +84,48 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, SVecMatchesDefinition)
+{
+    using IPA = IPA<Curve>;
+    constexpr size_t log_n = 7;
+    std::vector<Fr> round_challenges_inv(log_n);
+    for (auto& challenge : round_challenges_inv) {
+        challenge = Fr::random_element();
+    }
+    auto s_vec = IPA::compute_s_vec(round_challenges_inv);
+    for (size_t i = 0; i < (1 << log_n); i++) {
+        Fr expected = Fr::one();
+        for (size_t j = 0; j < log_n; j++) {
+            if (((i >> j) & 1) != 0) {
+                expected *= round_challenges_inv[log_n - 1 - j];
+            }
+        }
+        EXPECT_EQ(s_vec[i], expected);
+    }
+}
+
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    std::vector<IPA::ReducedClaim> claims;
+    for (size_t n : std::array<size_t, 3>{ 128, 64, 128 }) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        const OpeningClaim<Curve> opening_claim{ opening_pair, this->commit(poly) };
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+        auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+        claims.emplace_back(IPA::reduce_verify(this->vk(), opening_claim, verifier_transcript));
+    }
+    EXPECT_TRUE(IPA::batch_verify(this->vk(), claims));
+
+    // A single bad claim makes the whole batch fail
+    claims[1].a_zero += Fr::one();
+    EXPECT_FALSE(IPA::batch_verify(this->vk(), claims));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -2,6 +2,7 @@
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -68,42 +69,46 @@ template <typename Curve> class ZeroMorphProver_ {
         ASSERT(log_N == u_challenge.size());
 
         // Define the vector of quotients q_k, k = 0, ..., log_N-1
-        std::vector<Polynomial> quotients;
-        for (size_t k = 0; k < log_N; ++k) {
-            size_t size = 1 << k;
-            quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
-        }
+        std::vector<Polynomial> quotients(log_N);
 
         // Compute the coefficients of q_{n-1}
         size_t size_q = 1 << (log_N - 1);
         Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
-        }
+        run_loop_in_parallel_if_effective(
+            size_q,
+            [&](size_t start, size_t end) {
+                for (size_t l = start; l < end; ++l) {
+                    q[l] = polynomial[size_q + l] - polynomial[l];
+                }
+            },
+            /*finite_field_additions_per_iteration=*/1);
 
         quotients[log_N - 1] = q.share();
 
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
-
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
+        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0. Only the low half of each update of f is
+        // needed after the next quotient has been computed, so the update and the quotient are computed in the same
+        // pass, and the low half of f is updated in place: the entries of the high half that are read are never
+        // written, so the pass can be split between threads.
         for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
-
+            const FF& u = u_challenge[log_N - k];
             size_q = size_q / 2;
-            q = Polynomial{ size_q };
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
-            }
-
+            Polynomial next_q{ size_q };
+            run_loop_in_parallel_if_effective(
+                size_q,
+                [&](size_t start, size_t end) {
+                    for (size_t l = start; l < end; ++l) {
+                        // f_k[l] = f[l] + u_{n-k} * q[l]
+                        FF f_k_lo = polynomial[l] + u * q[l];
+                        FF f_k_hi = polynomial[size_q + l] + u * q[size_q + l];
+                        polynomial[l] = f_k_lo;
+                        next_q[l] = f_k_hi - f_k_lo;
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/3,
+                /*finite_field_multiplications_per_iteration=*/2);
+
+            q = next_q.share();
             quotients[log_N - k - 1] = q.share();
-            g = f_k;
         }
 
         return quotients;
@@ -127,21 +132,32 @@ template <typename Curve> class ZeroMorphProver_ {
     {
         // Batched lifted degree quotient polynomial
         auto result = Polynomial(N);
+        if (quotients.empty()) {
+            return result;
+        }
 
         // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
-        size_t k = 0;
-        auto scalar = FF(1); // y^k
-        for (auto& quotient : quotients) {
-            // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k -
-            // 1}) then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
-            auto deg_k = static_cast<size_t>((1 << k) - 1);
-            size_t offset = N - deg_k - 1;
-            for (size_t idx = 0; idx < deg_k + 1; ++idx) {
-                result[offset + idx] += scalar * quotient[idx];
-            }
-            scalar *= y_challenge; // update batching scalar y^k
-            k++;
-        }
+        // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k - 1})
+        // then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1. All the
+        // shifted q_k end at index N - 1, so \hat{q} is computed over the range of the largest one, each thread
+        // accumulating every q_k into its own part of that range.
+        const size_t num_quotients = quotients.size();
+        const std::vector<FF> scalars = powers_of_challenge(y_challenge, num_quotients); // y^k
+        const size_t range_size = static_cast<size_t>(1) << (num_quotients - 1);
+        const size_t range_start = N - range_size;
+        run_loop_in_parallel_if_effective(
+            range_size,
+            [&](size_t start, size_t end) {
+                for (size_t k = 0; k < num_quotients; ++k) {
+                    auto deg_k = static_cast<size_t>((1 << k) - 1);
+                    size_t offset = N - deg_k - 1;
+                    for (size_t idx = std::max(range_start + start, offset); idx < range_start + end; ++idx) {
+                        result[idx] += scalars[k] * quotients[k][idx - offset];
+                    }
+                }
+            },
+            /*finite_field_additions_per_iteration=*/2,
+            /*finite_field_multiplications_per_iteration=*/2);
 
         return result;
     }
@@ -306,6 +322,38 @@ template <typename Curve> class ZeroMorphProver_ {
         return batched_shifted_quotient;
     }
 
+    /**
+     * @brief Accumulate \sum_i scalars[i] * polynomials[i] into result
+     * @details This is a multi-polynomial AXPY done in a single pass over the result: the range of the result is split
+     * between threads, and each thread walks its part in small blocks, accumulating every polynomial into a block while
+     * it stays in cache. Compared to one add_scaled per polynomial, this writes the result once rather than once per
+     * polynomial.
+     */
+    static void batch_polynomials(Polynomial& result, RefSpan<Polynomial> polynomials, std::span<const FF> scalars)
+    {
+        static constexpr size_t BLOCK_SIZE = 1 << 8;
+        ASSERT(polynomials.size() == scalars.size());
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            ASSERT(polynomials[i].size() <= result.size());
+        }
+        run_loop_in_parallel_if_effective(
+            result.size(),
+            [&](size_t start, size_t end) {
+                for (size_t block_start = start; block_start < end; block_start += BLOCK_SIZE) {
+                    const size_t block_end = std::min(block_start + BLOCK_SIZE, end);
+                    for (size_t i = 0; i < polynomials.size(); ++i) {
+                        const Polynomial& polynomial = polynomials[i];
+                        const size_t limit = std::min(block_end, polynomial.size());
+                        for (size_t idx = block_start; idx < limit; ++idx) {
+                            result[idx] += scalars[i] * polynomial[idx];
+                        }
+                    }
+                }
+            },
+            /*finite_field_additions_per_iteration=*/polynomials.size(),
+            /*finite_field_multiplications_per_iteration=*/polynomials.size());
+    }
+
     /**
      * @brief Prove a set of multilinear evaluation claims for unshifted polynomials f_i and to-be-shifted
      * polynomials g_i
@@ -343,40 +391,43 @@ template <typename Curve> class ZeroMorphProver_ {
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
         FF batched_evaluation{ 0 };
-        Polynomial f_batched(N); // batched unshifted polynomials
         FF batching_scalar{ 1 };
-        for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
-            batched_evaluation += batching_scalar * f_eval;
-            batching_scalar *= rho;
-        }
-
-        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
-        for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
-            batched_evaluation += batching_scalar * g_shift_eval;
-            batching_scalar *= rho;
+        auto next_batching_scalars = [&](RefSpan<FF> evaluations) {
+            std::vector<FF> scalars;
+            scalars.reserve(evaluations.size());
+            for (size_t i = 0; i < evaluations.size(); ++i) {
+                scalars.emplace_back(batching_scalar);
+                batched_evaluation += batching_scalar * evaluations[i];
+                batching_scalar *= rho;
+            }
+            return scalars;
         };
+        const std::vector<FF> f_scalars = next_batching_scalars(f_evaluations);
+        const std::vector<FF> g_scalars = next_batching_scalars(g_shift_evaluations);
+        const std::vector<FF> concatenation_scalars = next_batching_scalars(concatenated_evaluations);
+
+        Polynomial f_batched(N); // batched unshifted polynomials
+        batch_polynomials(f_batched, f_polynomials, f_scalars);
+        Polynomial g_batched(N); // batched to-be-shifted polynomials
+        batch_polynomials(g_batched, g_polynomials, g_scalars);
 
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
         // Concatenated polynomials
         Polynomial concatenated_batched(N);
+        batch_polynomials(concatenated_batched, concatenated_polynomials, concatenation_scalars);
 
-        // construct concatention_groups_batched
+        // construct concatention_groups_batched, batching the j-th element of every group
         std::vector<Polynomial> concatenation_groups_batched;
-        for (size_t i = 0; i < num_chunks_per_group; ++i) {
-            concatenation_groups_batched.push_back(Polynomial(N));
-        }
-        // for each group
-        for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
-            // for each element in a group
-            for (size_t j = 0; j < num_chunks_per_group; ++j) {
-                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
+        for (size_t j = 0; j < num_chunks_per_group; ++j) {
+            std::vector<Polynomial*> chunks;
+            for (size_t i = 0; i < num_groups; ++i) {
+                chunks.emplace_back(&concatenation_groups[i][j]);
             }
-            batched_evaluation += batching_scalar * concatenated_evaluations[i];
-            batching_scalar *= rho;
+            concatenation_groups_batched.push_back(Polynomial(N));
+            batch_polynomials(concatenation_groups_batched.back(),
+                              RefSpan<Polynomial>(chunks.data(), chunks.size()),
+                              concatenation_scalars);
         }
 
         // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
@@ -386,7 +437,7 @@ template <typename Curve> class ZeroMorphProver_ {
         f_polynomial += concatenated_batched;
 
         // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
+        auto quotients = compute_multilinear_quotients(std::move(f_polynomial), u_challenge);
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
         std::vector<Commitment> q_k_commitments;
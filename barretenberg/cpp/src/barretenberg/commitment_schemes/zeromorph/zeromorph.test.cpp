@@ -359,6 +359,59 @@ TYPED_TEST(ZeroMorphTest, BatchedLiftedDegreeQuotient)
     EXPECT_EQ(batched_quotient, batched_quotient_expected);
 }
 
+/**
+ * @brief Check the multithreaded prover computations against their definitions on polynomials large enough to be
+ * split between threads
+ */
+TYPED_TEST(ZeroMorphTest, ParallelQuotientsAndBatching)
+{
+    using ZeroMorphProver = ZeroMorphProver_<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t N = 1 << 12;
+    const size_t log_N = numeric::get_msb(N);
+
+    // The quotients satisfy f(z) - f(u) = \sum_k (z_k - u_k) * q_k(z_0, ..., z_{k-1}) at a random z
+    Polynomial multilinear_f = this->random_polynomial(N);
+    std::vector<Fr> u_challenge = this->random_evaluation_point(log_N);
+    std::vector<Fr> z_challenge = this->random_evaluation_point(log_N);
+    auto quotients = ZeroMorphProver::compute_multilinear_quotients(multilinear_f, u_challenge);
+    Fr result = multilinear_f.evaluate_mle(z_challenge) - multilinear_f.evaluate_mle(u_challenge);
+    result -= (z_challenge[0] - u_challenge[0]) * quotients[0][0];
+    for (size_t k = 1; k < log_N; ++k) {
+        std::vector<Fr> z_partial(z_challenge.begin(), z_challenge.begin() + static_cast<std::ptrdiff_t>(k));
+        result -= (z_challenge[k] - u_challenge[k]) * quotients[k].evaluate_mle(z_partial);
+    }
+    EXPECT_EQ(result, 0);
+
+    // \hat{q} accumulates y^k * q_k at the offset N - 2^k
+    auto y_challenge = Fr::random_element();
+    auto batched_quotient = ZeroMorphProver::compute_batched_lifted_degree_quotient(quotients, y_challenge, N);
+    auto batched_quotient_expected = Polynomial(N);
+    Fr scalar = 1;
+    for (size_t k = 0; k < log_N; ++k) {
+        for (size_t idx = 0; idx < quotients[k].size(); ++idx) {
+            batched_quotient_expected[N - quotients[k].size() + idx] += scalar * quotients[k][idx];
+        }
+        scalar *= y_challenge;
+    }
+    EXPECT_EQ(batched_quotient, batched_quotient_expected);
+
+    // Batching polynomials of different sizes in one pass agrees with adding them one by one
+    std::vector<Polynomial> polynomials;
+    std::vector<Fr> scalars;
+    auto batched_expected = Polynomial(N);
+    for (size_t i = 0; i < 5; ++i) {
+        polynomials.emplace_back(this->random_polynomial(N >> i));
+        scalars.emplace_back(Fr::random_element());
+        batched_expected.add_scaled(polynomials.back(), scalars.back());
+    }
+    auto batched = Polynomial(N);
+    ZeroMorphProver::batch_polynomials(batched, RefVector(polynomials), scalars);
+    EXPECT_EQ(batched, batched_expected);
+}
+
 /**
  * @brief Test function for constructing partially evaluated quotient \zeta_x
  *
@@ -1,10 +1,17 @@
 #include "slab_allocator.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <barretenberg/common/assert.hpp>
 #include <barretenberg/common/log.hpp>
 #include <barretenberg/common/mem.hpp>
+#include <barretenberg/numeric/bitop/get_msb.hpp>
 #include <cstddef>
-#include <numeric>
+#include <cstdint>
+#include <map>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 #define LOGGING 0
 
@@ -19,10 +26,6 @@ namespace {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 bool allocator_destroyed = false;
 
-// Slabs that are being manually managed by the user.
-// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-std::unordered_map<void*, std::shared_ptr<void>> manual_slabs;
-
 template <typename... Args> inline void dbg_info(Args... args)
 {
 #if LOGGING == 1
@@ -34,49 +37,156 @@ template <typename... Args> inline void dbg_info(Args... args)
 }
 
 /**
- * Allows preallocating memory slabs sized to serve the fact that these slabs of memory follow certain sizing
- * patterns and numbers based on prover system type and circuit size. Without the slab allocator, memory
- * fragmentation prevents proof construction when approaching memory space limits (4GB in WASM).
+ * Slabs are pooled in power-of-two size classes: a slab of class c holds 2^c bytes plus a fixed tail. The tail lets
+ * requests slightly over a power of two, like polynomials of size 2^k with their extra coefficient for shifts, use the
+ * class of 2^k rather than one twice as large. Requests under MIN_POOLED_SIZE are not pooled.
+ */
+constexpr size_t MIN_SIZE_CLASS_LOG = 16;
+constexpr size_t NUM_SIZE_CLASSES = 48 - MIN_SIZE_CLASS_LOG;
+constexpr size_t SIZE_CLASS_TAIL = 512 * 32;
+constexpr size_t MIN_POOLED_SIZE = size_t{ 1 } << MIN_SIZE_CLASS_LOG;
+constexpr size_t NOT_POOLED = NUM_SIZE_CLASSES;
+
+// Only the classes of slabs up to 1MiB are cached per thread, and only a few slabs of each. Larger slabs go straight
+// to the shared pool, where taking the lock is negligible next to the work done on the slab.
+constexpr size_t NUM_THREAD_CACHED_CLASSES = 5;
+constexpr size_t THREAD_CACHE_DEPTH = 4;
+
+// The registry of pooled raw slabs is split into shards with a lock each, so that threads freeing slabs concurrently
+// rarely contend
+constexpr size_t NUM_RAW_SLAB_SHARDS = 16;
+
+size_t get_size_class(size_t size)
+{
+    if (size < MIN_POOLED_SIZE) {
+        return NOT_POOLED;
+    }
+    // Smallest c with size <= 2^c + SIZE_CLASS_TAIL
+    const auto log_size = static_cast<size_t>(bb::numeric::get_msb(static_cast<uint64_t>(size - SIZE_CLASS_TAIL - 1)));
+    const size_t size_class = std::max(log_size + 1, MIN_SIZE_CLASS_LOG) - MIN_SIZE_CLASS_LOG;
+    return size_class < NUM_SIZE_CLASSES ? size_class : NOT_POOLED;
+}
+
+size_t get_slab_size(size_t size_class)
+{
+    return (size_t{ 1 } << (size_class + MIN_SIZE_CLASS_LOG)) + SIZE_CLASS_TAIL;
+}
+
+/**
+ * The size class and generation of the pooled slabs handed out by get_mem_slab_raw, by address.
+ *
+ * Pointers that are not in the registry were not pooled: either small raw slabs or foreign allocations such as the
+ * buffers of to_heap_buffer, that are freed through the same c_bind. Nothing is ever read in front of a pointer.
+ */
+class RawSlabRegistry {
+  public:
+    struct Entry {
+        size_t size_class;
+        uint64_t generation;
+    };
+
+    void add(void* ptr, Entry entry)
+    {
+        auto& shard = get_shard(ptr);
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(shard.mutex);
+#endif
+        shard.slabs[ptr] = entry;
+    }
+
+    std::optional<Entry> remove(void* ptr)
+    {
+        auto& shard = get_shard(ptr);
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(shard.mutex);
+#endif
+        auto it = shard.slabs.find(ptr);
+        if (it == shard.slabs.end()) {
+            return std::nullopt;
+        }
+        const Entry entry = it->second;
+        shard.slabs.erase(it);
+        return entry;
+    }
+
+  private:
+    struct Shard {
+#ifndef NO_MULTITHREADING
+        std::mutex mutex;
+#endif
+        std::unordered_map<void*, Entry> slabs;
+    };
+    std::array<Shard, NUM_RAW_SLAB_SHARDS> shards;
+
+    Shard& get_shard(void* ptr)
+    {
+        // Pooled slabs are at least 64KiB, the bits under the page size are mostly the same for all of them
+        return shards[(reinterpret_cast<uintptr_t>(ptr) >> 12) % NUM_RAW_SLAB_SHARDS];
+    }
+};
+
+// Defined before the pool, so that it outlives the pool and can be used until allocator_destroyed is set
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+RawSlabRegistry raw_slabs;
+
+/**
+ * The pool of released slabs shared by all threads, with one lock per size class.
  *
- * If no circuit_size_hint is given to the constructor, it behaves as a standard memory allocator.
+ * Every slab is tagged with the generation of the pool it was taken in. release() moves the pool to a new generation
+ * and frees what it holds, slabs of an older generation are then freed rather than pooled when they come back.
  */
-class SlabAllocator {
+class SlabPool {
   private:
-    size_t circuit_size_hint_;
-    std::map<size_t, std::list<void*>> memory_store;
+    size_t circuit_size_hint_ = 0;
+    std::atomic<uint64_t> generation_ = 0;
+    std::array<std::vector<void*>, NUM_SIZE_CLASSES> free_slabs;
 #ifndef NO_MULTITHREADING
-    std::mutex memory_store_mutex;
+    std::array<std::mutex, NUM_SIZE_CLASSES> free_slabs_mutexes;
 #endif
 
   public:
-    ~SlabAllocator();
-    SlabAllocator() = default;
-    SlabAllocator(const SlabAllocator& other) = delete;
-    SlabAllocator(SlabAllocator&& other) = delete;
-    SlabAllocator& operator=(const SlabAllocator& other) = delete;
-    SlabAllocator& operator=(SlabAllocator&& other) = delete;
+    std::atomic<size_t> num_allocations = 0;
+    std::atomic<size_t> num_thread_cache_hits = 0;
+    std::atomic<size_t> num_shared_pool_hits = 0;
+    std::atomic<size_t> num_system_allocations = 0;
+    std::atomic<size_t> bytes_in_use = 0;
+    std::atomic<size_t> peak_bytes_in_use = 0;
+    std::atomic<size_t> bytes_cached = 0;
+
+    ~SlabPool();
+    SlabPool() = default;
+    SlabPool(const SlabPool& other) = delete;
+    SlabPool(SlabPool&& other) = delete;
+    SlabPool& operator=(const SlabPool& other) = delete;
+    SlabPool& operator=(SlabPool&& other) = delete;
 
     void init(size_t circuit_size_hint);
 
-    std::shared_ptr<void> get(size_t size);
+    uint64_t get_generation() const { return generation_.load(std::memory_order_acquire); }
 
-    size_t get_total_size();
+    void* take(size_t size_class);
+
+    void give_back(void* ptr, size_t size_class, uint64_t generation);
+
+    void release();
+
+    void mark_in_use(size_t slab_size);
 
   private:
-    void release(void* ptr, size_t size);
+    void free_all(size_t size_class);
 };
 
-SlabAllocator::~SlabAllocator()
+SlabPool::~SlabPool()
 {
     allocator_destroyed = true;
-    for (auto& e : memory_store) {
-        for (auto& p : e.second) {
+    for (auto& slabs : free_slabs) {
+        for (auto* p : slabs) {
             aligned_free(p);
         }
     }
 }
 
-void SlabAllocator::init(size_t circuit_size_hint)
+void SlabPool::init(size_t circuit_size_hint)
 {
     if (circuit_size_hint <= circuit_size_hint_) {
         return;
@@ -85,12 +195,7 @@ void SlabAllocator::init(size_t circuit_size_hint)
     circuit_size_hint_ = circuit_size_hint;
 
     // Free any existing slabs.
-    for (auto& e : memory_store) {
-        for (auto& p : e.second) {
-            aligned_free(p);
-        }
-    }
-    memory_store.clear();
+    release();
 
     dbg_info("slab allocator initing for size: ", circuit_size_hint);
 
@@ -98,137 +203,322 @@ void SlabAllocator::init(size_t circuit_size_hint)
         return;
     }
 
-    // Over-allocate because we know there are requests for circuit_size + n. (somewhat arbitrary n = 512)
-    size_t overalloc = 512;
-    size_t base_size = circuit_size_hint + overalloc;
-
+    // Number of slabs to preallocate for vectors of (multiple * circuit size) field elements.
     std::map<size_t, size_t> prealloc_num;
+    prealloc_num[1] = 11;     // Composer base selector vectors.
+    prealloc_num[2] = 1;      // Miscellaneous.
+    prealloc_num[3] = 1;      // Variables.
+    prealloc_num[4] = 1 +     // SRS monomial points.
+                      4 +     // Coset-fft wires.
+                      15 +    // Coset-fft constraint selectors.
+                      8 +     // Coset-fft perm selectors.
+                      1 +     // Coset-fft sorted poly.
+                      1 +     // Pippenger point_schedule.
+                      4;      // Miscellaneous.
+    prealloc_num[8] = 1 +     // Proving key evaluation domain roots.
+                      2;      // Pippenger point_pairs.
+
+    const uint64_t generation = get_generation();
+    for (auto [multiple, num] : prealloc_num) {
+        const size_t size_class = get_size_class(circuit_size_hint * multiple * 32);
+        if (size_class == NOT_POOLED) {
+            continue;
+        }
+        const size_t slab_size = get_slab_size(size_class);
+        for (size_t i = 0; i < num; ++i) {
+            bytes_cached += slab_size;
+            give_back(aligned_alloc(32, slab_size), size_class, generation);
+            dbg_info("Allocated memory slab of size: ", slab_size, " total: ", bytes_cached.load());
+        }
+    }
+}
 
-    // Size comments below assume a base (circuit) size of 2^19, 524288 bytes.
-
-    // /* 0.5 MiB */ prealloc_num[base_size * 1] = 2;        // Batch invert skipped temporary.
-    // /*   2 MiB */ prealloc_num[base_size * 4] = 4 +       // Composer base wire vectors.
-    //                                             1;        // Miscellaneous.
-    // /*   6 MiB */ prealloc_num[base_size * 12] = 2 +      // next_var_index, prev_var_index
-    //                                              2;       // real_variable_index, real_variable_tags
-    /*  16 MiB */ prealloc_num[base_size * 32] = 11;      // Composer base selector vectors.
-    /*  32 MiB */ prealloc_num[base_size * 32 * 2] = 1;   // Miscellaneous.
-    /*  50 MiB */ prealloc_num[base_size * 32 * 3] = 1;   // Variables.
-    /*  64 MiB */ prealloc_num[base_size * 32 * 4] = 1 +  // SRS monomial points.
-                                                     4 +  // Coset-fft wires.
-                                                     15 + // Coset-fft constraint selectors.
-                                                     8 +  // Coset-fft perm selectors.
-                                                     1 +  // Coset-fft sorted poly.
-                                                     1 +  // Pippenger point_schedule.
-                                                     4;   // Miscellaneous.
-    /* 128 MiB */ prealloc_num[base_size * 32 * 8] = 1 +  // Proving key evaluation domain roots.
-                                                     2;   // Pippenger point_pairs.
-
-    for (auto& e : prealloc_num) {
-        for (size_t i = 0; i < e.second; ++i) {
-            auto size = e.first;
-            memory_store[size].push_back(aligned_alloc(32, size));
-            dbg_info("Allocated memory slab of size: ", size, " total: ", get_total_size());
+void* SlabPool::take(size_t size_class)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(free_slabs_mutexes[size_class]);
+#endif
+    auto& slabs = free_slabs[size_class];
+    if (slabs.empty()) {
+        return nullptr;
+    }
+    auto* ptr = slabs.back();
+    slabs.pop_back();
+    return ptr;
+}
+
+void SlabPool::give_back(void* ptr, size_t size_class, uint64_t generation)
+{
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(free_slabs_mutexes[size_class]);
+#endif
+        // Checked under the lock, so that a concurrent release() either sees this slab or it sees the new generation
+        if (generation == get_generation()) {
+            free_slabs[size_class].push_back(ptr);
+            return;
         }
     }
+    bytes_cached -= get_slab_size(size_class);
+    aligned_free(ptr);
+}
+
+void SlabPool::release()
+{
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    for (size_t size_class = 0; size_class < NUM_SIZE_CLASSES; ++size_class) {
+        free_all(size_class);
+    }
 }
 
-std::shared_ptr<void> SlabAllocator::get(size_t req_size)
+void SlabPool::free_all(size_t size_class)
 {
+    std::vector<void*> slabs;
+    {
 #ifndef NO_MULTITHREADING
-    std::unique_lock<std::mutex> lock(memory_store_mutex);
+        std::unique_lock<std::mutex> lock(free_slabs_mutexes[size_class]);
 #endif
+        std::swap(slabs, free_slabs[size_class]);
+    }
+    bytes_cached -= slabs.size() * get_slab_size(size_class);
+    for (auto* p : slabs) {
+        aligned_free(p);
+    }
+}
 
-    auto it = memory_store.lower_bound(req_size);
+void SlabPool::mark_in_use(size_t slab_size)
+{
+    const size_t in_use = bytes_in_use += slab_size;
+    size_t peak = peak_bytes_in_use.load(std::memory_order_relaxed);
+    while (in_use > peak && !peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {
+    }
+}
 
-    // Can use a preallocated slab that is less than 2 times the requested size.
-    if (it != memory_store.end() && it->first < req_size * 2) {
-        size_t size = it->first;
-        auto* ptr = it->second.back();
-        it->second.pop_back();
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+SlabPool pool;
 
-        if (it->second.empty()) {
-            memory_store.erase(it);
-        }
+// Trivially destructible, so it can still be read after the cache of its thread is destroyed
+#ifdef NO_MULTITHREADING
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+bool thread_cache_destroyed = false;
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool thread_cache_destroyed = false;
+#endif
 
-        if (req_size >= circuit_size_hint_ && size > req_size + req_size / 10) {
-            dbg_info("WARNING: Using memory slab of size: ",
-                     size,
-                     " for requested ",
-                     req_size,
-                     " total: ",
-                     get_total_size());
-        } else {
-            dbg_info("Reusing memory slab of size: ", size, " for requested ", req_size, " total: ", get_total_size());
+/**
+ * A few slabs of the small size classes, kept by a thread in front of the shared pool. It only holds slabs of its
+ * generation and empties itself when it finds the pool has moved on.
+ */
+struct ThreadCache {
+    uint64_t generation = 0;
+    std::array<std::vector<void*>, NUM_THREAD_CACHED_CLASSES> slabs;
+
+    ThreadCache()
+        : generation(pool.get_generation())
+    {
+        for (auto& class_slabs : slabs) {
+            class_slabs.reserve(THREAD_CACHE_DEPTH);
         }
-
-        return { ptr, [this, size](void* p) {
-                    if (allocator_destroyed) {
-                        aligned_free(p);
-                        return;
-                    }
-                    this->release(p, size);
-                } };
     }
-
-    if (req_size > static_cast<size_t>(1024 * 1024)) {
-        dbg_info("WARNING: Allocating unmanaged memory slab of size: ", req_size);
+    ~ThreadCache()
+    {
+        // The cache of the main thread is destroyed before the statics, which may still release slabs
+        thread_cache_destroyed = true;
+        if (allocator_destroyed) {
+            for (auto& class_slabs : slabs) {
+                for (auto* p : class_slabs) {
+                    aligned_free(p);
+                }
+            }
+            return;
+        }
+        for (size_t size_class = 0; size_class < NUM_THREAD_CACHED_CLASSES; ++size_class) {
+            for (auto* p : slabs[size_class]) {
+                pool.give_back(p, size_class, generation);
+            }
+        }
     }
-    if (req_size % 32 == 0) {
-        return { aligned_alloc(32, req_size), aligned_free };
+    ThreadCache(const ThreadCache& other) = delete;
+    ThreadCache(ThreadCache&& other) = delete;
+    ThreadCache& operator=(const ThreadCache& other) = delete;
+    ThreadCache& operator=(ThreadCache&& other) = delete;
+
+    void update_generation(uint64_t current_generation)
+    {
+        if (generation == current_generation) {
+            return;
+        }
+        for (size_t size_class = 0; size_class < NUM_THREAD_CACHED_CLASSES; ++size_class) {
+            pool.bytes_cached -= slabs[size_class].size() * get_slab_size(size_class);
+            for (auto* p : slabs[size_class]) {
+                aligned_free(p);
+            }
+            slabs[size_class].clear();
+        }
+        generation = current_generation;
     }
-    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-    return { malloc(req_size), free };
+};
+
+/**
+ * Get the cache of this thread, or nullptr once it has been destroyed at thread or process exit.
+ */
+ThreadCache* get_thread_cache()
+{
+    if (thread_cache_destroyed) {
+        return nullptr;
+    }
+#ifdef NO_MULTITHREADING
+    static ThreadCache cache;
+#else
+    thread_local ThreadCache cache;
+#endif
+    return &cache;
 }
 
-size_t SlabAllocator::get_total_size()
+/**
+ * Get a slab of the given size class, from the cache of this thread, the shared pool or the heap in that order.
+ */
+void* acquire_slab(size_t size_class, uint64_t& generation)
 {
-    return std::accumulate(memory_store.begin(), memory_store.end(), size_t{ 0 }, [](size_t acc, const auto& kv) {
-        return acc + kv.first * kv.second.size();
-    });
+    generation = pool.get_generation();
+    const size_t slab_size = get_slab_size(size_class);
+    pool.mark_in_use(slab_size);
+
+    auto* cache = size_class < NUM_THREAD_CACHED_CLASSES ? get_thread_cache() : nullptr;
+    if (cache != nullptr) {
+        cache->update_generation(generation);
+        auto& slabs = cache->slabs[size_class];
+        if (!slabs.empty()) {
+            auto* ptr = slabs.back();
+            slabs.pop_back();
+            pool.num_thread_cache_hits++;
+            pool.bytes_cached -= slab_size;
+            return ptr;
+        }
+    }
+    if (auto* ptr = pool.take(size_class)) {
+        pool.num_shared_pool_hits++;
+        pool.bytes_cached -= slab_size;
+        return ptr;
+    }
+    pool.num_system_allocations++;
+    if (slab_size > static_cast<size_t>(1024 * 1024)) {
+        dbg_info("Allocating memory slab of size: ", slab_size);
+    }
+    return aligned_alloc(32, slab_size);
 }
 
-void SlabAllocator::release(void* ptr, size_t size)
+void release_slab(void* ptr, size_t size_class, uint64_t generation)
 {
-#ifndef NO_MULTITHREADING
-    std::unique_lock<std::mutex> lock(memory_store_mutex);
-#endif
-    memory_store[size].push_back(ptr);
-    // dbg_info("Pooled poly memory of size: ", size, " total: ", get_total_size());
+    if (allocator_destroyed) {
+        aligned_free(ptr);
+        return;
+    }
+    const size_t slab_size = get_slab_size(size_class);
+    pool.bytes_in_use -= slab_size;
+
+    const uint64_t current_generation = pool.get_generation();
+    if (generation != current_generation) {
+        aligned_free(ptr);
+        return;
+    }
+    pool.bytes_cached += slab_size;
+    auto* cache = size_class < NUM_THREAD_CACHED_CLASSES ? get_thread_cache() : nullptr;
+    if (cache != nullptr) {
+        cache->update_generation(current_generation);
+        auto& slabs = cache->slabs[size_class];
+        if (slabs.size() < THREAD_CACHE_DEPTH) {
+            slabs.push_back(ptr);
+            return;
+        }
+    }
+    pool.give_back(ptr, size_class, generation);
 }
-// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-SlabAllocator allocator;
 } // namespace
 
 namespace bb {
 void init_slab_allocator(size_t circuit_subgroup_size)
 {
-    allocator.init(circuit_subgroup_size);
+    pool.init(circuit_subgroup_size);
 }
 
-// auto init = ([]() {
-//     init_slab_allocator(524288);
-//     return 0;
-// })();
-
 std::shared_ptr<void> get_mem_slab(size_t size)
 {
-    return allocator.get(size);
+    pool.num_allocations++;
+    const size_t size_class = get_size_class(size);
+    if (size_class == NOT_POOLED) {
+        if (size % 32 == 0) {
+            return { aligned_alloc(32, size), aligned_free };
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+        return { malloc(size), free };
+    }
+
+    uint64_t generation = 0;
+    auto* ptr = acquire_slab(size_class, generation);
+    return { ptr, [size_class, generation](void* p) { release_slab(p, size_class, generation); } };
 }
 
 void* get_mem_slab_raw(size_t size)
 {
-    auto slab = get_mem_slab(size);
-    manual_slabs[slab.get()] = slab;
-    return slab.get();
+    pool.num_allocations++;
+    const size_t size_class = get_size_class(size);
+    if (size_class == NOT_POOLED) {
+        const size_t slab_size = std::max(size, size_t{ 1 });
+        return aligned_alloc(32, pad(slab_size, 32));
+    }
+
+    uint64_t generation = 0;
+    auto* ptr = acquire_slab(size_class, generation);
+    raw_slabs.add(ptr, { .size_class = size_class, .generation = generation });
+    return ptr;
 }
 
 void free_mem_slab_raw(void* p)
 {
+    if (p == nullptr) {
+        return;
+    }
     if (allocator_destroyed) {
         aligned_free(p);
         return;
     }
-    manual_slabs.erase(p);
+    if (const auto entry = raw_slabs.remove(p)) {
+        release_slab(p, entry->size_class, entry->generation);
+        return;
+    }
+    aligned_free(p);
+}
+
+SlabAllocatorStats get_slab_allocator_stats()
+{
+    return {
+        .num_allocations = pool.num_allocations.load(),
+        .num_thread_cache_hits = pool.num_thread_cache_hits.load(),
+        .num_shared_pool_hits = pool.num_shared_pool_hits.load(),
+        .num_system_allocations = pool.num_system_allocations.load(),
+        .bytes_in_use = pool.bytes_in_use.load(),
+        .peak_bytes_in_use = pool.peak_bytes_in_use.load(),
+        .bytes_cached = pool.bytes_cached.load(),
+    };
+}
+
+void release_mem_slabs()
+{
+    pool.release();
+    if (auto* cache = get_thread_cache()) {
+        cache->update_generation(pool.get_generation());
+    }
+}
+
+SlabCacheFlushGuard::SlabCacheFlushGuard()
+{
+    pool.peak_bytes_in_use = pool.bytes_in_use.load();
+}
+
+SlabCacheFlushGuard::~SlabCacheFlushGuard()
+{
+    release_mem_slabs();
 }
 } // namespace bb
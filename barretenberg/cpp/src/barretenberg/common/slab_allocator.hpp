@@ -1,6 +1,7 @@
 #pragma once
 #include "./assert.hpp"
 #include "./log.hpp"
+#include <cstddef>
 #include <list>
 #include <map>
 #include <memory>
@@ -12,35 +13,79 @@
 namespace bb {
 
 /**
- * Allocates a bunch of memory slabs sized to serve an UltraPLONK proof construction.
- * If you want normal memory allocator behavior, just don't call this init function.
+ * Preallocates memory slabs sized to serve an UltraPLONK proof construction of the given circuit size, which keeps
+ * memory fragmentation low when approaching memory space limits (4GB in WASM).
+ * Without it, slabs are only allocated on demand and recycled as they are released.
  *
- * WARNING: If client code is still holding onto slabs from previous use, when those slabs
- * are released they'll end up back in the allocator. That's probably not desired as presumably
- * those slabs are now too small, so they're effectively leaked. But good client code should be releasing
- * it's resources promptly anyway. It's not considered "proper use" to call init, take slab, and call init
- * again, before releasing the slab.
- *
- * TODO: Take a composer type and allocate slabs according to those requirements?
- * TODO: De-globalise. Init the allocator and pass around. Use a PolynomialFactory (PolynomialStore?).
- * TODO: Consider removing, but once due-dilligence has been done that we no longer have memory limitations.
+ * Calling it again with a larger size calls release_mem_slabs before preallocating for the new size.
  */
 void init_slab_allocator(size_t circuit_subgroup_size);
 
 /**
- * Returns a slab from the preallocated pool of slabs, or fallback to a new heap allocation (32 byte aligned).
+ * Returns a slab from the pool of released slabs, or fallback to a new heap allocation (32 byte aligned).
  * Ref counted result so no need to manually free.
+ *
+ * Slabs of 64KiB and more are pooled in power-of-two size classes, each thread keeps a small cache of the smaller ones
+ * in front of a pool shared by all threads.
  */
 std::shared_ptr<void> get_mem_slab(size_t size);
 
 /**
  * Sometimes you want a raw pointer to a slab so you can manage when it's released manually (e.g. c_binds, containers).
- * This still gets a slab with a shared_ptr, but holds the shared_ptr internally until free_mem_slab_raw is called.
+ * The slab is returned to the allocator when free_mem_slab_raw is called.
  */
 void* get_mem_slab_raw(size_t size);
 
+/**
+ * Returns a slab of get_mem_slab_raw to the allocator. Any other pointer allocated with aligned_alloc, like the buffers
+ * of to_heap_buffer, is freed with aligned_free.
+ */
 void free_mem_slab_raw(void*);
 
+/**
+ * Statistics of the slab allocator since the start of the process. Byte counts only cover pooled slabs, requests too
+ * small to be pooled are only counted in num_allocations.
+ */
+struct SlabAllocatorStats {
+    size_t num_allocations = 0;
+    // Pooled requests served by the cache of the requesting thread, by the shared pool or by a new heap allocation
+    size_t num_thread_cache_hits = 0;
+    size_t num_shared_pool_hits = 0;
+    size_t num_system_allocations = 0;
+    size_t bytes_in_use = 0;
+    size_t peak_bytes_in_use = 0;
+    size_t bytes_cached = 0;
+};
+
+SlabAllocatorStats get_slab_allocator_stats();
+
+/**
+ * Frees every slab cached by the allocator. Slabs that are in use at that point are freed, rather than cached, when
+ * they are eventually released, so nothing allocated before the call is ever reused after it.
+ *
+ * @details This only bumps a generation counter and empties the shared pool and the cache of the calling thread: the
+ * caches of other threads are emptied by those threads on their next use of the allocator.
+ */
+void release_mem_slabs();
+
+/**
+ * Resets the peak statistic when created and calls release_mem_slabs when it goes out of scope, so that a process
+ * proving many circuits back to back does not carry the size classes of one proof into the next.
+ *
+ * @details The flush is global: it is not limited to the slabs allocated while the guard was alive, and releases what
+ * every thread has cached, including for work that overlaps the guard. The caches of worker threads are only reclaimed
+ * lazily, on their next use of the allocator.
+ */
+class SlabCacheFlushGuard {
+  public:
+    SlabCacheFlushGuard();
+    ~SlabCacheFlushGuard();
+    SlabCacheFlushGuard(const SlabCacheFlushGuard& other) = delete;
+    SlabCacheFlushGuard(SlabCacheFlushGuard&& other) = delete;
+    SlabCacheFlushGuard& operator=(const SlabCacheFlushGuard& other) = delete;
+    SlabCacheFlushGuard& operator=(SlabCacheFlushGuard&& other) = delete;
+};
+
 /**
  * Allocator for containers such as std::vector. Makes them leverage the underlying slab allocator where possible.
  */
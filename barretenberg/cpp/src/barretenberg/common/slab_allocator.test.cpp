@@ -0,0 +1,149 @@
+#include "slab_allocator.hpp"
+#include "bbmalloc.hpp"
+#include "serialize.hpp"
+#include "thread.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+// A polynomial of 2^16 field elements, with its extra coefficient for shifts
+constexpr size_t POLYNOMIAL_SIZE = ((1UL << 16) + 1) * 32;
+} // namespace
+
+TEST(SlabAllocator, ReleasedSlabIsReused)
+{
+    SlabCacheFlushGuard flush_guard;
+    void* first = get_mem_slab(POLYNOMIAL_SIZE).get();
+    auto stats_before = get_slab_allocator_stats();
+    auto slab = get_mem_slab(POLYNOMIAL_SIZE);
+    auto stats_after = get_slab_allocator_stats();
+
+    EXPECT_EQ(slab.get(), first);
+    EXPECT_EQ(stats_after.num_system_allocations, stats_before.num_system_allocations);
+    EXPECT_EQ(stats_after.num_thread_cache_hits + stats_after.num_shared_pool_hits,
+              stats_before.num_thread_cache_hits + stats_before.num_shared_pool_hits + 1);
+    // The slab comes from the size class of 2^16 field elements, not the next one
+    EXPECT_GE(stats_after.bytes_in_use, POLYNOMIAL_SIZE);
+    EXPECT_LT(stats_after.bytes_in_use, 2 * POLYNOMIAL_SIZE);
+    EXPECT_EQ(stats_after.peak_bytes_in_use, stats_after.bytes_in_use);
+}
+
+TEST(SlabAllocator, SmallSlabIsCachedByThread)
+{
+    SlabCacheFlushGuard flush_guard;
+    void* first = get_mem_slab(1UL << 18).get();
+    auto stats_before = get_slab_allocator_stats();
+    auto slab = get_mem_slab(1UL << 18);
+    auto stats_after = get_slab_allocator_stats();
+
+    EXPECT_EQ(slab.get(), first);
+    EXPECT_EQ(stats_after.num_thread_cache_hits, stats_before.num_thread_cache_hits + 1);
+}
+
+TEST(SlabAllocator, FlushGuardReleasesCachedSlabs)
+{
+    {
+        SlabCacheFlushGuard flush_guard;
+        std::vector<std::shared_ptr<void>> slabs;
+        for (size_t i = 0; i < 8; ++i) {
+            slabs.emplace_back(get_mem_slab((1UL << 18) << i));
+        }
+        slabs.clear();
+        EXPECT_EQ(get_slab_allocator_stats().bytes_in_use, 0UL);
+        EXPECT_GT(get_slab_allocator_stats().bytes_cached, 0UL);
+    }
+    EXPECT_EQ(get_slab_allocator_stats().bytes_cached, 0UL);
+}
+
+TEST(SlabAllocator, SlabInUseIsNotCachedAfterRelease)
+{
+    auto slab = get_mem_slab(POLYNOMIAL_SIZE);
+    release_mem_slabs();
+    slab.reset();
+    EXPECT_EQ(get_slab_allocator_stats().bytes_in_use, 0UL);
+    EXPECT_EQ(get_slab_allocator_stats().bytes_cached, 0UL);
+}
+
+TEST(SlabAllocator, RawSlabIsReused)
+{
+    SlabCacheFlushGuard flush_guard;
+    void* first = bbmalloc(POLYNOMIAL_SIZE);
+    EXPECT_EQ(get_slab_allocator_stats().bytes_in_use, get_slab_allocator_stats().peak_bytes_in_use);
+    bbfree(first);
+    EXPECT_EQ(get_slab_allocator_stats().bytes_in_use, 0UL);
+
+    void* slab = bbmalloc(POLYNOMIAL_SIZE);
+    void* small = bbmalloc(100);
+    EXPECT_EQ(slab, first);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(small) % 32, 0UL);
+    bbfree(small);
+    bbfree(slab);
+}
+
+TEST(SlabAllocator, FreeHeapBufferThroughRawSlabs)
+{
+    // The c_binds return buffers of to_heap_buffer, that are not slabs, to be freed with bbfree
+    std::vector<uint8_t> value(POLYNOMIAL_SIZE, 1);
+    uint8_t* small = to_heap_buffer(std::vector<uint8_t>{ 1, 2, 3 });
+    uint8_t* large = to_heap_buffer(value);
+    bbfree(small);
+    bbfree(large);
+    EXPECT_EQ(get_slab_allocator_stats().bytes_in_use, 0UL);
+}
+
+#ifndef NO_MULTITHREADING
+TEST(SlabAllocator, SlabReleasedAfterThreadCacheIsDestroyed)
+{
+    SlabCacheFlushGuard flush_guard;
+    void* released = nullptr;
+    std::thread([&released]() {
+        // Constructed before the cache of the thread, so destroyed after it
+        thread_local std::shared_ptr<void> slab;
+        slab = get_mem_slab(1UL << 18);
+        released = slab.get();
+    }).join();
+
+    // The slab went to the shared pool rather than into the destroyed cache
+    auto stats_before = get_slab_allocator_stats();
+    auto slab = get_mem_slab(1UL << 18);
+    EXPECT_EQ(slab.get(), released);
+    EXPECT_EQ(get_slab_allocator_stats().num_shared_pool_hits, stats_before.num_shared_pool_hits + 1);
+}
+#endif
+
+TEST(SlabAllocator, ContainerSlabAllocator)
+{
+    SlabCacheFlushGuard flush_guard;
+    std::vector<uint32_t, ContainerSlabAllocator<uint32_t>> small(3, 1);
+    std::vector<uint32_t, ContainerSlabAllocator<uint32_t>> large(1UL << 20, 2);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(small.data()) % 32, 0UL);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(large.data()) % 32, 0UL);
+    EXPECT_EQ(small[2], 1U);
+    EXPECT_EQ(large.back(), 2U);
+    EXPECT_GE(get_slab_allocator_stats().bytes_in_use, large.size() * sizeof(uint32_t));
+}
+
+TEST(SlabAllocator, ConcurrentAllocations)
+{
+    SlabCacheFlushGuard flush_guard;
+    parallel_for(64, [](size_t i) {
+        for (size_t j = 0; j < 16; ++j) {
+            auto slab = get_mem_slab(POLYNOMIAL_SIZE << ((i + j) % 6));
+            static_cast<uint8_t*>(slab.get())[POLYNOMIAL_SIZE - 1] = static_cast<uint8_t>(i);
+        }
+    });
+    EXPECT_EQ(get_slab_allocator_stats().bytes_in_use, 0UL);
+}
+
+TEST(SlabAllocator, SlabHeldByStaticIsReleasedAtExit)
+{
+    // Statics are destroyed after the cache of the main thread, so this slab, of a size class cached by threads, is
+    // released at exit once the cache is gone. A regression shows as a crash of the test binary on exit. The slab is
+    // still in use until then, so this test comes last.
+    static std::shared_ptr<void> slab = get_mem_slab(1UL << 18);
+    EXPECT_NE(slab.get(), nullptr);
+}
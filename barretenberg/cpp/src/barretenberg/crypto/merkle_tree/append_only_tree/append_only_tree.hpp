@@ -1,5 +1,7 @@
 #pragma once
 #include "../hash_path.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <span>
 
 namespace bb::crypto::merkle_tree {
 
@@ -53,6 +55,7 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
     fr get_element_or_zero(size_t level, const index_t& index) const;
 
     void write_node(size_t level, const index_t& index, const fr& value);
+    void write_nodes(size_t level, const index_t& start_index, std::span<const fr> values);
     std::pair<bool, fr> read_node(size_t level, const index_t& index) const;
 
     Store& store_;
@@ -79,6 +82,14 @@ AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, size_t depth,
     }
     zero_hashes_[0] = current;
     root_ = current;
+
+    // A persistent store may already hold a tree, in which case we carry on from where it was left
+    if constexpr (requires { store.max_index(depth); }) {
+        if (auto last_leaf = store.max_index(depth)) {
+            size_ = index_t(*last_leaf) + 1;
+            root_ = read_node(0, 0).second;
+        }
+    }
 }
 
 template <typename Store, typename HashingPolicy> AppendOnlyTree<Store, HashingPolicy>::~AppendOnlyTree() {}
@@ -124,25 +135,35 @@ template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, Hashi
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::add_values(const std::vector<fr>& values)
 {
+    // Each thread hashes at least this many pairs of a level of the sub tree
+    constexpr size_t MIN_HASHES_PER_THREAD = 8;
+
     index_t index = size();
     size_t number_to_insert = values.size();
     size_t level = depth_;
     std::vector<fr> hashes = values;
+    std::vector<fr> next_hashes(number_to_insert / 2);
 
     // Add the values at the leaf nodes of the tree
-    for (size_t i = 0; i < number_to_insert; ++i) {
-        write_node(level, index + i, hashes[i]);
-    }
+    write_nodes(level, index, std::span{ hashes.data(), number_to_insert });
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them, one level at a time. The nodes of a level are independent of each
+    // other, so each level is split across the available threads.
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
-        for (size_t i = 0; i < number_to_insert; ++i) {
-            hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
-            write_node(level, index + i, hashes[i]);
-        }
+        const size_t num_threads = calculate_num_threads(number_to_insert, MIN_HASHES_PER_THREAD);
+        const size_t chunk_size = (number_to_insert + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * chunk_size;
+            const size_t end = std::min(start + chunk_size, number_to_insert);
+            for (size_t i = start; i < end; ++i) {
+                next_hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
+            }
+        });
+        std::swap(hashes, next_hashes);
+        write_nodes(level, index, std::span{ hashes.data(), number_to_insert });
     }
 
     // Hash from the root of the sub-tree to the root of the overall tree
@@ -180,6 +201,25 @@ void AppendOnlyTree<Store, HashingPolicy>::write_node(size_t level, const index_
     store_.put(level, size_t(index), buf);
 }
 
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::write_nodes(size_t level,
+                                                       const index_t& start_index,
+                                                       std::span<const fr> values)
+{
+    std::vector<std::vector<uint8_t>> bufs(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        write(bufs[i], values[i]);
+    }
+    // Stores that can take a whole level at once avoid the per-node overhead of put
+    if constexpr (requires(std::vector<std::vector<uint8_t>>& data) { store_.put_batch(level, size_t(0), data); }) {
+        store_.put_batch(level, size_t(start_index), bufs);
+    } else {
+        for (size_t i = 0; i < values.size(); ++i) {
+            store_.put(level, size_t(start_index) + i, bufs[i]);
+        }
+    }
+}
+
 template <typename Store, typename HashingPolicy>
 std::pair<bool, fr> AppendOnlyTree<Store, HashingPolicy>::read_node(size_t level, const index_t& index) const
 {
@@ -0,0 +1,57 @@
+#pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <unistd.h>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief Reads exactly `size` bytes at `offset` of the file, aborting if the file is shorter or cannot be read
+ */
+inline void read_all(int fd, void* data, size_t size, uint64_t offset)
+{
+    auto* dest = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        const ssize_t result = pread(fd, dest, size, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            throw_or_abort("failed to read from file");
+        }
+        dest += result;
+        size -= static_cast<size_t>(result);
+        offset += static_cast<uint64_t>(result);
+    }
+}
+
+/**
+ * @brief Writes exactly `size` bytes at `offset` of the file, aborting if they cannot be written
+ */
+inline void write_all(int fd, const void* data, size_t size, uint64_t offset)
+{
+    const auto* src = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        const ssize_t result = pwrite(fd, src, size, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            throw_or_abort("failed to write to file");
+        }
+        src += result;
+        size -= static_cast<size_t>(result);
+        offset += static_cast<uint64_t>(result);
+    }
+}
+
+inline void sync_file(int fd)
+{
+    if (fsync(fd) != 0) {
+        throw_or_abort("failed to sync file");
+    }
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,312 @@
+#include "file_store.hpp"
+#include "file_io.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <iterator>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+constexpr uint64_t FILE_STORE_MAGIC = 0x313054534c494642; // "BFILST01"
+constexpr uint64_t PAGE_RECORD = 1;
+constexpr uint64_t COMMIT_RECORD = 2;
+constexpr size_t BITMAP_BYTES = FileStore::NODES_PER_PAGE / 8;
+// Page keys hold the level in their top byte and the page number in the rest
+constexpr size_t LEVEL_SHIFT = 56;
+constexpr uint64_t MAX_PAGE = (1ULL << LEVEL_SHIFT) - 1;
+// Pages are written to the file in chunks of about this many bytes
+constexpr size_t WRITE_CHUNK_SIZE = 1 << 20;
+
+struct FileStoreHeader {
+    uint64_t magic;
+    uint64_t nodes_per_page;
+};
+
+struct RecordHeader {
+    uint64_t kind;
+    // The page key of a page record, the number of pages of a commit record
+    uint64_t key;
+    uint64_t value_size;
+};
+
+uint64_t page_key(size_t level, size_t page)
+{
+    ASSERT(level < 256 && page <= MAX_PAGE);
+    return (static_cast<uint64_t>(level) << LEVEL_SHIFT) | page;
+}
+
+size_t page_bytes(size_t value_size)
+{
+    return BITMAP_BYTES + FileStore::NODES_PER_PAGE * value_size;
+}
+
+bool is_present(const FileStore::Page& page, size_t slot)
+{
+    return ((page.bytes[slot / 8] >> (slot % 8)) & 1) != 0;
+}
+
+bool read_slot(const FileStore::Page& page, size_t slot, std::vector<uint8_t>& data)
+{
+    if (!is_present(page, slot)) {
+        return false;
+    }
+    const auto value = page.bytes.begin() + static_cast<std::ptrdiff_t>(BITMAP_BYTES + slot * page.value_size);
+    data.assign(value, value + static_cast<std::ptrdiff_t>(page.value_size));
+    return true;
+}
+} // namespace
+
+bool FileStore::Snapshot::get(size_t level, size_t index, std::vector<uint8_t>& data) const
+{
+    return store_->get(*directory_, page_key(level, index / NODES_PER_PAGE), index % NODES_PER_PAGE, data);
+}
+
+FileStore::FileStore(std::string const& path, size_t cache_pages)
+    : fd_(open(path.c_str(), O_RDWR | O_CREAT, 0644))
+    , end_(0)
+    , directory_(std::make_shared<Directory>())
+    , cache_(cache_pages)
+{
+    if (fd_ < 0) {
+        throw_or_abort("FileStore: could not open " + path);
+    }
+    recover();
+}
+
+FileStore::~FileStore()
+{
+    close(fd_);
+}
+
+void FileStore::recover()
+{
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        throw_or_abort("FileStore: could not stat file");
+    }
+    const auto file_size = static_cast<uint64_t>(st.st_size);
+
+    FileStoreHeader header{ .magic = FILE_STORE_MAGIC, .nodes_per_page = NODES_PER_PAGE };
+    if (file_size < sizeof(header)) {
+        // A new store, or one that did not get as far as writing its header
+        write_all(fd_, &header, sizeof(header), 0);
+        sync_file(fd_);
+        end_ = sizeof(header);
+        return;
+    }
+    read_all(fd_, &header, sizeof(header), 0);
+    if (header.magic != FILE_STORE_MAGIC || header.nodes_per_page != NODES_PER_PAGE) {
+        throw_or_abort("FileStore: file is not a store or uses a different page size");
+    }
+
+    // Replay the log, only applying the pages of a commit once its commit record has been seen
+    auto directory = std::make_shared<Directory>();
+    std::vector<std::pair<uint64_t, uint64_t>> pending;
+    uint64_t offset = sizeof(header);
+    end_ = offset;
+    while (offset + sizeof(RecordHeader) <= file_size) {
+        RecordHeader record;
+        read_all(fd_, &record, sizeof(record), offset);
+        offset += sizeof(record);
+        if (record.kind == PAGE_RECORD && record.value_size > 0 && record.value_size <= file_size &&
+            offset + page_bytes(record.value_size) <= file_size) {
+            pending.emplace_back(record.key, offset);
+            offset += page_bytes(record.value_size);
+        } else if (record.kind == COMMIT_RECORD && record.key == pending.size()) {
+            for (const auto& [key, page_offset] : pending) {
+                (*directory)[key] = page_offset;
+            }
+            pending.clear();
+            end_ = offset;
+        } else {
+            break;
+        }
+    }
+
+    // Drop whatever follows the last complete commit, so that new commits are appended right after it
+    if (end_ != file_size && ftruncate(fd_, static_cast<off_t>(end_)) != 0) {
+        throw_or_abort("FileStore: could not truncate unfinished commit");
+    }
+    directory_ = std::move(directory);
+}
+
+std::shared_ptr<const FileStore::Page> FileStore::load_page(uint64_t offset) const
+{
+    if (auto page = cache_.get(offset)) {
+        return *page;
+    }
+    RecordHeader record;
+    read_all(fd_, &record, sizeof(record), offset - sizeof(record));
+    auto page = std::make_shared<Page>(
+        Page{ .value_size = record.value_size, .bytes = std::vector<uint8_t>(page_bytes(record.value_size)) });
+    read_all(fd_, page->bytes.data(), page->bytes.size(), offset);
+    cache_.put(offset, page);
+    return page;
+}
+
+bool FileStore::get(const Directory& directory, uint64_t key, size_t slot, std::vector<uint8_t>& data) const
+{
+    auto it = directory.find(key);
+    if (it == directory.end()) {
+        return false;
+    }
+    return read_slot(*load_page(it->second), slot, data);
+}
+
+bool FileStore::get(size_t level, size_t index, std::vector<uint8_t>& data) const
+{
+    const uint64_t key = page_key(level, index / NODES_PER_PAGE);
+    const size_t slot = index % NODES_PER_PAGE;
+    std::shared_ptr<const Directory> directory;
+    {
+        std::shared_lock lock(mutex_);
+        auto it = dirty_.find(key);
+        if (it != dirty_.end()) {
+            return read_slot(it->second, slot, data);
+        }
+        directory = directory_;
+    }
+    return get(*directory, key, slot, data);
+}
+
+void FileStore::put(size_t level, size_t index, const std::vector<uint8_t>& data)
+{
+    std::unique_lock lock(mutex_);
+    put_locked(level, index, data);
+}
+
+void FileStore::put_batch(size_t level, size_t start_index, const std::vector<std::vector<uint8_t>>& data)
+{
+    std::unique_lock lock(mutex_);
+    for (size_t i = 0; i < data.size(); ++i) {
+        put_locked(level, start_index + i, data[i]);
+    }
+}
+
+void FileStore::put_locked(size_t level, size_t index, const std::vector<uint8_t>& data)
+{
+    if (data.empty()) {
+        throw_or_abort("FileStore: cannot store empty values");
+    }
+    const uint64_t key = page_key(level, index / NODES_PER_PAGE);
+    const size_t slot = index % NODES_PER_PAGE;
+
+    auto it = dirty_.find(key);
+    if (it == dirty_.end()) {
+        // The first write to a page since the last commit starts from its committed version, if there is one
+        auto committed = directory_->find(key);
+        Page page = committed == directory_->end()
+                        ? Page{ .value_size = data.size(), .bytes = std::vector<uint8_t>(page_bytes(data.size())) }
+                        : *load_page(committed->second);
+        it = dirty_.emplace(key, std::move(page)).first;
+    }
+
+    Page& page = it->second;
+    if (data.size() != page.value_size) {
+        throw_or_abort("FileStore: all values on a page must have the same size");
+    }
+    page.bytes[slot / 8] |= static_cast<uint8_t>(1 << (slot % 8));
+    std::copy(data.begin(),
+              data.end(),
+              page.bytes.begin() + static_cast<std::ptrdiff_t>(BITMAP_BYTES + slot * page.value_size));
+}
+
+std::optional<size_t> FileStore::max_index(size_t level) const
+{
+    const uint64_t first_key = page_key(level, 0);
+    const uint64_t last_key = page_key(level, MAX_PAGE);
+    auto highest_key = [&](const auto& pages) -> std::optional<uint64_t> {
+        auto it = pages.upper_bound(last_key);
+        if (it == pages.begin() || std::prev(it)->first < first_key) {
+            return std::nullopt;
+        }
+        return std::prev(it)->first;
+    };
+
+    std::shared_lock lock(mutex_);
+    const auto dirty_key = highest_key(dirty_);
+    const auto committed_key = highest_key(*directory_);
+    if (!dirty_key && !committed_key) {
+        return std::nullopt;
+    }
+
+    // A dirty page supersedes the committed version of the same page
+    uint64_t key = 0;
+    const Page* page = nullptr;
+    std::shared_ptr<const Page> committed_page;
+    if (dirty_key && (!committed_key || *dirty_key >= *committed_key)) {
+        key = *dirty_key;
+        page = &dirty_.at(key);
+    } else {
+        key = *committed_key;
+        committed_page = load_page(directory_->at(key));
+        page = committed_page.get();
+    }
+    for (size_t slot = NODES_PER_PAGE; slot > 0; --slot) {
+        if (is_present(*page, slot - 1)) {
+            return static_cast<size_t>(key & MAX_PAGE) * NODES_PER_PAGE + slot - 1;
+        }
+    }
+    // Pages are only ever created by writing a value to them
+    return std::nullopt;
+}
+
+void FileStore::commit()
+{
+    std::unique_lock lock(mutex_);
+    if (dirty_.empty()) {
+        return;
+    }
+
+    auto directory = std::make_shared<Directory>(*directory_);
+    std::vector<uint8_t> buffer;
+    uint64_t offset = end_;
+    auto append = [&](const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+    for (const auto& [key, page] : dirty_) {
+        const RecordHeader record{ .kind = PAGE_RECORD, .key = key, .value_size = page.value_size };
+        append(&record, sizeof(record));
+        (*directory)[key] = offset + buffer.size();
+        append(page.bytes.data(), page.bytes.size());
+        if (buffer.size() >= WRITE_CHUNK_SIZE) {
+            write_all(fd_, buffer.data(), buffer.size(), offset);
+            offset += buffer.size();
+            buffer.clear();
+        }
+    }
+    write_all(fd_, buffer.data(), buffer.size(), offset);
+    offset += buffer.size();
+
+    // The pages have to be durable before the commit record that makes them visible is written
+    sync_file(fd_);
+    const RecordHeader commit_record{ .kind = COMMIT_RECORD, .key = dirty_.size(), .value_size = 0 };
+    write_all(fd_, &commit_record, sizeof(commit_record), offset);
+    sync_file(fd_);
+    end_ = offset + sizeof(commit_record);
+
+    for (auto& [key, page] : dirty_) {
+        cache_.put(directory->at(key), std::make_shared<const Page>(std::move(page)));
+    }
+    directory_ = std::move(directory);
+    dirty_.clear();
+}
+
+void FileStore::rollback()
+{
+    std::unique_lock lock(mutex_);
+    dirty_.clear();
+}
+
+FileStore::Snapshot FileStore::snapshot() const
+{
+    std::shared_lock lock(mutex_);
+    return Snapshot(this, directory_);
+}
+
+} // namespace bb::crypto::merkle_tree
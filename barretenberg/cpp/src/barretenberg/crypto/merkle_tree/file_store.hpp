@@ -0,0 +1,115 @@
+#pragma once
+#include "lru_cache.hpp"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A persistent, log-structured backing store for merkle trees
+ *
+ * @details Nodes are grouped into pages of NODES_PER_PAGE consecutive indices on one level. Writes are collected in
+ * in-memory dirty pages and only reach the file when commit() is called, which appends every dirty page followed by a
+ * commit record. Pages are never modified in place: the file is synced before the commit record is written, so after a
+ * crash the file holds a sequence of complete commits plus possibly an unfinished one, which is discarded when the
+ * store is reopened. The location of the latest version of every page is kept in an in-memory directory, and recently
+ * used pages are kept in an LRU cache, so the tree itself is not bounded by the available memory.
+ *
+ * All values on a page must have the same size, which is recorded with the page. The store is safe to use from
+ * several threads at once (e.g. the parallel insertions of an IndexedTree), and snapshot() gives readers a consistent
+ * view of the last commit that is unaffected by later writes.
+ *
+ * File layout:
+ *
+ * FileStoreHeader
+ * RecordHeader(PAGE)   | presence bitmap | NODES_PER_PAGE values     } once per page written by a commit
+ * RecordHeader(COMMIT)                                                 once per commit
+ * ...
+ */
+class FileStore {
+  public:
+    static constexpr size_t NODES_PER_PAGE = 256;
+    static constexpr size_t DEFAULT_CACHE_PAGES = 1 << 14;
+
+    struct Page {
+        size_t value_size;
+        // A presence bitmap of NODES_PER_PAGE bits followed by NODES_PER_PAGE values of value_size bytes
+        std::vector<uint8_t> bytes;
+    };
+    // Maps the key of every committed page to the offset of its latest version in the file
+    using Directory = std::map<uint64_t, uint64_t>;
+
+    /**
+     * @brief A read-only view of the store as of the commit preceding its creation
+     * @details The store must outlive its snapshots
+     */
+    class Snapshot {
+      public:
+        bool get(size_t level, size_t index, std::vector<uint8_t>& data) const;
+
+      private:
+        friend class FileStore;
+        Snapshot(const FileStore* store, std::shared_ptr<const Directory> directory)
+            : store_(store)
+            , directory_(std::move(directory))
+        {}
+
+        const FileStore* store_;
+        std::shared_ptr<const Directory> directory_;
+    };
+
+    /**
+     * @brief Opens the store at `path`, creating it if it does not exist, and recovers its last complete commit
+     */
+    FileStore(std::string const& path, size_t cache_pages = DEFAULT_CACHE_PAGES);
+    FileStore(FileStore const& other) = delete;
+    FileStore(FileStore&& other) = delete;
+    FileStore& operator=(FileStore const& other) = delete;
+    FileStore& operator=(FileStore&& other) = delete;
+    ~FileStore();
+
+    void put(size_t level, size_t index, const std::vector<uint8_t>& data);
+    /**
+     * @brief Writes consecutive nodes of a level, starting at start_index, under a single lock
+     */
+    void put_batch(size_t level, size_t start_index, const std::vector<std::vector<uint8_t>>& data);
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const;
+
+    /**
+     * @brief Returns the highest index populated on the given level, including uncommitted writes
+     */
+    std::optional<size_t> max_index(size_t level) const;
+
+    /**
+     * @brief Appends all writes since the last commit to the file and makes them durable
+     */
+    void commit();
+
+    /**
+     * @brief Discards all writes since the last commit
+     */
+    void rollback();
+
+    Snapshot snapshot() const;
+
+  private:
+    void put_locked(size_t level, size_t index, const std::vector<uint8_t>& data);
+    bool get(const Directory& directory, uint64_t key, size_t slot, std::vector<uint8_t>& data) const;
+    std::shared_ptr<const Page> load_page(uint64_t offset) const;
+    void recover();
+
+    int fd_;
+    uint64_t end_;
+    mutable std::shared_mutex mutex_;
+    std::shared_ptr<const Directory> directory_;
+    std::map<uint64_t, Page> dirty_;
+    // Page versions are immutable once written, so they are cached by their offset in the file
+    mutable LruCache<uint64_t, std::shared_ptr<const Page>> cache_;
+};
+
+} // namespace bb::crypto::merkle_tree
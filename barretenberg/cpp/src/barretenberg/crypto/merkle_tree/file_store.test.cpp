@@ -0,0 +1,137 @@
+#include "file_store.hpp"
+#include "append_only_tree/append_only_tree.hpp"
+#include "array_store.hpp"
+#include "barretenberg/common/streams.hpp"
+#include "barretenberg/common/test.hpp"
+#include <filesystem>
+#include <unistd.h>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+std::vector<uint8_t> value_of(uint64_t value)
+{
+    std::vector<uint8_t> buf;
+    write(buf, fr(value));
+    return buf;
+}
+} // namespace
+
+class FileStoreTest : public ::testing::Test {
+  public:
+    // Named after the process and the test, so that concurrent runs of the suite do not share a file
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("bb_" + std::to_string(getpid()) + "_" +
+                         ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".dat"))
+                           .string();
+
+    void SetUp() override { std::filesystem::remove(path); }
+    void TearDown() override { std::filesystem::remove(path); }
+};
+
+TEST_F(FileStoreTest, CommittedValuesSurviveReopening)
+{
+    {
+        FileStore store(path);
+        for (size_t i = 0; i < 1000; ++i) {
+            store.put(3, i * 7, value_of(i));
+        }
+        store.put(0, 0, value_of(42));
+        store.commit();
+        store.put(3, 1, value_of(1));
+    }
+
+    // A small cache makes sure that pages are read back from the file
+    FileStore store(path, 4);
+    std::vector<uint8_t> value;
+    for (size_t i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(store.get(3, i * 7, value));
+        EXPECT_EQ(value, value_of(i));
+    }
+    EXPECT_TRUE(store.get(0, 0, value));
+    EXPECT_EQ(value, value_of(42));
+    EXPECT_FALSE(store.get(3, 1, value));
+    EXPECT_EQ(store.max_index(3), 999UL * 7);
+    EXPECT_EQ(store.max_index(1), std::nullopt);
+}
+
+TEST_F(FileStoreTest, RollbackAndSnapshots)
+{
+    FileStore store(path);
+    std::vector<uint8_t> value;
+    store.put(1, 5, value_of(1));
+    store.commit();
+    auto snapshot = store.snapshot();
+
+    store.put(1, 5, value_of(2));
+    store.put(1, 600, value_of(3));
+    EXPECT_TRUE(store.get(1, 5, value));
+    EXPECT_EQ(value, value_of(2));
+    EXPECT_EQ(store.max_index(1), 600UL);
+
+    store.rollback();
+    EXPECT_TRUE(store.get(1, 5, value));
+    EXPECT_EQ(value, value_of(1));
+    EXPECT_FALSE(store.get(1, 600, value));
+    EXPECT_EQ(store.max_index(1), 5UL);
+
+    // A snapshot keeps seeing the commit it was taken after
+    store.put(1, 5, value_of(4));
+    store.commit();
+    EXPECT_TRUE(snapshot.get(1, 5, value));
+    EXPECT_EQ(value, value_of(1));
+    EXPECT_TRUE(store.snapshot().get(1, 5, value));
+    EXPECT_EQ(value, value_of(4));
+}
+
+TEST_F(FileStoreTest, DiscardsUnfinishedCommit)
+{
+    std::vector<uint8_t> value;
+    for (uint64_t i = 0; i < 2; ++i) {
+        FileStore store(path);
+        store.put(2, i, value_of(i));
+        store.commit();
+    }
+
+    // Cut the second commit short, as if the process had died while writing it
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    {
+        FileStore store(path);
+        EXPECT_TRUE(store.get(2, 0, value));
+        EXPECT_FALSE(store.get(2, 1, value));
+        store.put(2, 2, value_of(2));
+        store.commit();
+    }
+
+    FileStore store(path);
+    EXPECT_TRUE(store.get(2, 0, value));
+    EXPECT_TRUE(store.get(2, 2, value));
+    EXPECT_EQ(value, value_of(2));
+}
+
+TEST_F(FileStoreTest, AppendOnlyTreeCarriesOnAfterReopening)
+{
+    constexpr size_t depth = 10;
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> expected(array_store, depth);
+    {
+        FileStore store(path);
+        AppendOnlyTree<FileStore, Poseidon2HashPolicy> tree(store, depth);
+        for (size_t i = 0; i < 300; ++i) {
+            tree.add_value(fr(i));
+            expected.add_value(fr(i));
+        }
+        store.commit();
+    }
+
+    FileStore store(path);
+    AppendOnlyTree<FileStore, Poseidon2HashPolicy> tree(store, depth);
+    EXPECT_EQ(tree.size(), 300);
+    EXPECT_EQ(tree.root(), expected.root());
+
+    tree.add_values({ fr(1000), fr(1001) });
+    expected.add_values({ fr(1000), fr(1001) });
+    EXPECT_EQ(tree.root(), expected.root());
+    EXPECT_EQ(tree.get_hash_path(301), expected.get_hash_path(301));
+}
@@ -7,6 +7,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <array>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -25,7 +26,12 @@ struct Poseidon2HashPolicy {
         return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    static fr hash_pair(const fr& lhs, const fr& rhs)
+    {
+        // Hash straight from the stack, this is called for every node of the tree
+        const std::array<fr, 2> inputs{ lhs, rhs };
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::Sponge::hash_fixed_length(inputs);
+    }
 
     static fr zero_hash() { return fr::zero(); }
 };
@@ -40,6 +46,18 @@ inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
     return crypto::pedersen_hash::hash(inputs); // uses lookup tables
 }
 
+/**
+ * Hashes the consecutive pairs of a layer of a tree, all at once, to compute the layer above it.
+ */
+inline std::vector<bb::fr> hash_layer_native(std::vector<bb::fr> const& layer)
+{
+    std::vector<std::vector<bb::fr>> pairs(layer.size() / 2);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        pairs[i] = { layer[i * 2], layer[i * 2 + 1] };
+    }
+    return crypto::pedersen_hash::hash_batch(pairs);
+}
+
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
@@ -53,11 +71,7 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+        layer = hash_layer_native(layer);
     }
 
     return layer[0];
@@ -72,12 +86,8 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     auto layer = input;
     std::vector<bb::fr> tree(input);
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+        layer = hash_layer_native(layer);
+        tree.insert(tree.end(), layer.begin(), layer.end());
     }
 
     return tree;
@@ -0,0 +1,389 @@
+#include "file_leaves_store.hpp"
+#include "../file_io.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <iterator>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+constexpr uint64_t RUN_MAGIC = 0x314e5552464c4242; // "BBLFRUN1"
+// Runs are written to the file in chunks of about this many bytes
+constexpr size_t WRITE_CHUNK_SIZE = 1 << 20;
+constexpr size_t FENCE_SIZE = 4 * sizeof(uint64_t);
+
+struct RunHeader {
+    uint64_t magic;
+    uint64_t num_entries;
+    // The number of leaves whose values the runs up to and including this one hold
+    uint64_t num_leaves;
+};
+
+uint256_t to_uint256(const uint64_t (&limbs)[4])
+{
+    return { limbs[0], limbs[1], limbs[2], limbs[3] };
+}
+
+uint64_t num_blocks(uint64_t num_entries)
+{
+    return (num_entries + FileLeavesStore::ENTRIES_PER_BLOCK - 1) / FileLeavesStore::ENTRIES_PER_BLOCK;
+}
+
+std::vector<uint8_t> serialize_leaf(const indexed_leaf& leaf)
+{
+    std::vector<uint8_t> buf;
+    write(buf, leaf.value);
+    write(buf, leaf.nextIndex);
+    write(buf, leaf.nextValue);
+    return buf;
+}
+} // namespace
+
+/**
+ * @brief Writes a run entry by entry, so that a run never has to be held in memory as a whole
+ */
+class FileLeavesStore::RunWriter {
+  public:
+    RunWriter(int fd, uint64_t offset)
+        : fd_(fd)
+        , offset_(offset)
+        , position_(offset + sizeof(RunHeader))
+    {}
+
+    void add(const IndexEntry& entry)
+    {
+        if (num_entries_ % ENTRIES_PER_BLOCK == 0) {
+            fences_.insert(fences_.end(), std::begin(entry.value), std::end(entry.value));
+        }
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&entry);
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(entry));
+        ++num_entries_;
+        if (buffer_.size() >= WRITE_CHUNK_SIZE) {
+            flush_buffer();
+        }
+    }
+
+    /**
+     * @brief Writes the fences and then the header, which makes the run visible when the index is next opened
+     */
+    Run finish(uint64_t num_leaves)
+    {
+        flush_buffer();
+        write_all(fd_, fences_.data(), fences_.size() * sizeof(uint64_t), position_);
+        sync_file(fd_);
+        const RunHeader header{ .magic = RUN_MAGIC, .num_entries = num_entries_, .num_leaves = num_leaves };
+        write_all(fd_, &header, sizeof(header), offset_);
+        sync_file(fd_);
+
+        Run run{ .offset = offset_ + sizeof(RunHeader), .num_entries = num_entries_, .fences = {} };
+        run.fences.reserve(fences_.size() / 4);
+        for (size_t i = 0; i < fences_.size(); i += 4) {
+            run.fences.emplace_back(fences_[i], fences_[i + 1], fences_[i + 2], fences_[i + 3]);
+        }
+        return run;
+    }
+
+  private:
+    void flush_buffer()
+    {
+        write_all(fd_, buffer_.data(), buffer_.size(), position_);
+        position_ += buffer_.size();
+        buffer_.clear();
+    }
+
+    int fd_;
+    uint64_t offset_;
+    uint64_t position_;
+    uint64_t num_entries_ = 0;
+    std::vector<uint8_t> buffer_;
+    std::vector<uint64_t> fences_;
+};
+
+FileLeavesStore::FileLeavesStore(FileStore& store,
+                                 std::string const& index_path,
+                                 size_t flush_threshold,
+                                 size_t cache_blocks)
+    : store_(&store)
+    , index_path_(index_path)
+    , flush_threshold_(flush_threshold)
+    , index_fd_(-1)
+    , index_end_(0)
+    , indexed_leaves_(0)
+    , size_(0)
+    , committed_size_(0)
+    , cache_(std::make_unique<LruCache<uint64_t, std::shared_ptr<const Block>>>(cache_blocks))
+{
+    if (auto last_leaf = store_->max_index(LEAVES_LEVEL)) {
+        size_ = committed_size_ = index_t(*last_leaf) + 1;
+    }
+    open_index();
+    if (index_t(indexed_leaves_) > size_) {
+        throw_or_abort("FileLeavesStore: the index holds more leaves than the store");
+    }
+
+    // Index the leaves that were committed after the last run was flushed
+    std::vector<uint8_t> buf;
+    for (uint64_t i = indexed_leaves_; i < static_cast<uint64_t>(size_); ++i) {
+        if (store_->get(LEAVES_LEVEL, i, buf)) {
+            memtable_[uint256_t(from_buffer<fr>(buf, 0))] = i;
+        }
+    }
+}
+
+FileLeavesStore::FileLeavesStore(FileLeavesStore&& other) noexcept
+    : store_(other.store_)
+    , index_path_(std::move(other.index_path_))
+    , flush_threshold_(other.flush_threshold_)
+    , index_fd_(std::exchange(other.index_fd_, -1))
+    , index_end_(other.index_end_)
+    , indexed_leaves_(other.indexed_leaves_)
+    , runs_(std::move(other.runs_))
+    , memtable_(std::move(other.memtable_))
+    , pending_(std::move(other.pending_))
+    , size_(other.size_)
+    , committed_size_(other.committed_size_)
+    , cache_(std::move(other.cache_))
+{}
+
+FileLeavesStore::~FileLeavesStore()
+{
+    if (index_fd_ >= 0) {
+        close(index_fd_);
+    }
+}
+
+void FileLeavesStore::open_index()
+{
+    index_fd_ = open(index_path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (index_fd_ < 0) {
+        throw_or_abort("FileLeavesStore: could not open " + index_path_);
+    }
+    struct stat st;
+    if (fstat(index_fd_, &st) != 0) {
+        throw_or_abort("FileLeavesStore: could not stat index");
+    }
+    const auto file_size = static_cast<uint64_t>(st.st_size);
+
+    runs_.clear();
+    indexed_leaves_ = 0;
+    uint64_t offset = 0;
+    while (offset + sizeof(RunHeader) <= file_size) {
+        RunHeader header;
+        read_all(index_fd_, &header, sizeof(header), offset);
+        const uint64_t entries_offset = offset + sizeof(header);
+        const uint64_t blocks = num_blocks(header.num_entries);
+        if (header.magic != RUN_MAGIC || header.num_entries > file_size ||
+            entries_offset + header.num_entries * sizeof(IndexEntry) + blocks * FENCE_SIZE > file_size) {
+            break;
+        }
+
+        std::vector<uint64_t> fences(4 * blocks);
+        read_all(index_fd_,
+                 fences.data(),
+                 fences.size() * sizeof(uint64_t),
+                 entries_offset + header.num_entries * sizeof(IndexEntry));
+        Run run{ .offset = entries_offset, .num_entries = header.num_entries, .fences = {} };
+        run.fences.reserve(blocks);
+        for (size_t i = 0; i < fences.size(); i += 4) {
+            run.fences.emplace_back(fences[i], fences[i + 1], fences[i + 2], fences[i + 3]);
+        }
+        runs_.push_back(std::move(run));
+        indexed_leaves_ = std::max(indexed_leaves_, header.num_leaves);
+        offset = entries_offset + header.num_entries * sizeof(IndexEntry) + blocks * FENCE_SIZE;
+    }
+
+    // Drop a run that was not completely written
+    if (offset != file_size && ftruncate(index_fd_, static_cast<off_t>(offset)) != 0) {
+        throw_or_abort("FileLeavesStore: could not truncate unfinished run");
+    }
+    index_end_ = offset;
+}
+
+index_t FileLeavesStore::get_size() const
+{
+    return size_;
+}
+
+std::pair<bool, index_t> FileLeavesStore::find_low_value(const fr& new_value) const
+{
+    const uint256_t value(new_value);
+    std::optional<std::pair<uint256_t, index_t>> low;
+    auto consider = [&](const uint256_t& candidate, const index_t& index) {
+        if (!low || candidate > low->first) {
+            low = std::make_pair(candidate, index);
+        }
+    };
+
+    // The low value is the greatest value <= the requested one across the pending entries, the memtable and the runs
+    for (const auto* entries : { &pending_, &memtable_ }) {
+        auto it = entries->upper_bound(value);
+        if (it != entries->begin()) {
+            --it;
+            consider(it->first, it->second);
+        }
+    }
+    for (const Run& run : runs_) {
+        if (auto entry = find_in_run(run, value)) {
+            consider(to_uint256(entry->value), entry->index);
+        }
+    }
+    if (!low) {
+        throw_or_abort("FileLeavesStore: there is no leaf with a value lower than the one requested");
+    }
+    return std::make_pair(low->first == value, low->second);
+}
+
+indexed_leaf FileLeavesStore::get_leaf(const index_t& index) const
+{
+    ASSERT(index < size_);
+    std::vector<uint8_t> buf;
+    if (!store_->get(LEAVES_LEVEL, static_cast<size_t>(index), buf)) {
+        // A gap left by a batch that contained values which were already present
+        return indexed_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 };
+    }
+    return indexed_leaf{ .value = from_buffer<fr>(buf, 0),
+                         .nextIndex = from_buffer<uint256_t>(buf, 32),
+                         .nextValue = from_buffer<fr>(buf, 64) };
+}
+
+void FileLeavesStore::set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
+{
+    store_->put(LEAVES_LEVEL, static_cast<size_t>(index), serialize_leaf(leaf));
+    if (index >= size_) {
+        size_ = index + 1;
+    }
+    if (add_to_index) {
+        pending_[uint256_t(leaf.value)] = index;
+    }
+}
+
+void FileLeavesStore::append_leaf(const indexed_leaf& leaf)
+{
+    // A copy, since set_at_index updates size_ before it records the index of the leaf
+    index_t next_index = size_;
+    set_at_index(next_index, leaf, true);
+}
+
+void FileLeavesStore::commit()
+{
+    for (const auto& [value, index] : pending_) {
+        memtable_[value] = index;
+    }
+    pending_.clear();
+    committed_size_ = size_;
+    if (memtable_.size() >= flush_threshold_) {
+        flush();
+        if (runs_.size() > MAX_RUNS) {
+            compact();
+        }
+    }
+}
+
+void FileLeavesStore::rollback()
+{
+    pending_.clear();
+    size_ = committed_size_;
+}
+
+void FileLeavesStore::flush()
+{
+    RunWriter writer(index_fd_, index_end_);
+    for (const auto& [value, index] : memtable_) {
+        writer.add(IndexEntry{ .value = { value.data[0], value.data[1], value.data[2], value.data[3] },
+                               .index = static_cast<uint64_t>(index) });
+    }
+    Run run = writer.finish(static_cast<uint64_t>(committed_size_));
+    index_end_ = run.offset + run.num_entries * sizeof(IndexEntry) + run.fences.size() * FENCE_SIZE;
+    runs_.push_back(std::move(run));
+    indexed_leaves_ = static_cast<uint64_t>(committed_size_);
+    memtable_.clear();
+}
+
+void FileLeavesStore::compact()
+{
+    const std::string tmp_path = index_path_ + ".tmp";
+    const int fd = open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw_or_abort("FileLeavesStore: could not open " + tmp_path);
+    }
+
+    // Merge the runs into one, holding a single block of each in memory at a time
+    struct Cursor {
+        const Run* run;
+        size_t block;
+        Block entries;
+        size_t position;
+    };
+    std::vector<Cursor> cursors;
+    for (const Run& run : runs_) {
+        if (run.num_entries > 0) {
+            cursors.push_back(Cursor{ .run = &run, .block = 0, .entries = read_block(run, 0), .position = 0 });
+        }
+    }
+    RunWriter writer(fd, 0);
+    while (!cursors.empty()) {
+        auto next = std::min_element(cursors.begin(), cursors.end(), [](const Cursor& a, const Cursor& b) {
+            return to_uint256(a.entries[a.position].value) < to_uint256(b.entries[b.position].value);
+        });
+        writer.add(next->entries[next->position]);
+        if (++next->position < next->entries.size()) {
+            continue;
+        }
+        if (++next->block < num_blocks(next->run->num_entries)) {
+            next->entries = read_block(*next->run, next->block);
+            next->position = 0;
+        } else {
+            cursors.erase(next);
+        }
+    }
+    writer.finish(indexed_leaves_);
+    close(fd);
+
+    // Renaming the merged index over the old one means a crash leaves one or the other in place
+    if (std::rename(tmp_path.c_str(), index_path_.c_str()) != 0) {
+        throw_or_abort("FileLeavesStore: could not replace index");
+    }
+    close(index_fd_);
+    cache_->clear();
+    open_index();
+}
+
+FileLeavesStore::Block FileLeavesStore::read_block(const Run& run, size_t block) const
+{
+    const uint64_t first = block * ENTRIES_PER_BLOCK;
+    Block entries(std::min<uint64_t>(ENTRIES_PER_BLOCK, run.num_entries - first));
+    read_all(index_fd_, entries.data(), entries.size() * sizeof(IndexEntry), run.offset + first * sizeof(IndexEntry));
+    return entries;
+}
+
+std::optional<FileLeavesStore::IndexEntry> FileLeavesStore::find_in_run(const Run& run, const uint256_t& value) const
+{
+    auto fence = std::upper_bound(run.fences.begin(), run.fences.end(), value);
+    if (fence == run.fences.begin()) {
+        return std::nullopt;
+    }
+    const auto block = static_cast<size_t>(std::distance(run.fences.begin(), fence) - 1);
+    const uint64_t key = run.offset + block * ENTRIES_PER_BLOCK * sizeof(IndexEntry);
+    std::shared_ptr<const Block> entries;
+    if (auto cached = cache_->get(key)) {
+        entries = *cached;
+    } else {
+        entries = std::make_shared<const Block>(read_block(run, block));
+        cache_->put(key, entries);
+    }
+
+    // The block starts with a value <= the requested one, so the entry we are after is in this block
+    auto it = std::upper_bound(entries->begin(), entries->end(), value, [](const uint256_t& v, const IndexEntry& e) {
+        return v < to_uint256(e.value);
+    });
+    return *std::prev(it);
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,105 @@
+#pragma once
+#include "../file_store.hpp"
+#include "../lru_cache.hpp"
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "indexed_leaf.hpp"
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+typedef uint256_t index_t;
+
+/**
+ * @brief A persistent store of the leaves of an IndexedTree, with an index for O(logN) retrieval of 'low leaves'
+ *
+ * @details The leaves live on a reserved level of the FileStore backing the tree's nodes, so committing that store
+ * commits the nodes and the leaves together. The value -> index map is kept in a separate log-structured file: entries
+ * collect in memory and are flushed as an immutable sorted run once `flush_threshold` of them have been committed, and
+ * whenever there are more than MAX_RUNS runs they are merged into one. A run is searched through an in-memory fence
+ * index holding the first value of each of its blocks, and recently read blocks are kept in an LRU cache.
+ *
+ * The map is derived from the leaves: every run records how many leaves it covers and the leaves beyond the last run
+ * are indexed again when the store is opened, so losing the unflushed part of the map in a crash is harmless. For the
+ * same reason commit() must only be called once the FileStore has been committed.
+ *
+ * Run layout:
+ *
+ * RunHeader | num_entries IndexEntry, sorted by value | the value of every ENTRIES_PER_BLOCK-th entry
+ */
+class FileLeavesStore {
+  public:
+    static constexpr size_t LEAVES_LEVEL = 255;
+    static constexpr size_t DEFAULT_FLUSH_THRESHOLD = 1 << 16;
+    static constexpr size_t MAX_RUNS = 8;
+    static constexpr size_t ENTRIES_PER_BLOCK = 128;
+    static constexpr size_t DEFAULT_CACHE_BLOCKS = 1 << 12;
+
+    FileLeavesStore(FileStore& store,
+                    std::string const& index_path,
+                    size_t flush_threshold = DEFAULT_FLUSH_THRESHOLD,
+                    size_t cache_blocks = DEFAULT_CACHE_BLOCKS);
+    FileLeavesStore(FileLeavesStore const& other) = delete;
+    FileLeavesStore(FileLeavesStore&& other) noexcept;
+    FileLeavesStore& operator=(FileLeavesStore const& other) = delete;
+    FileLeavesStore& operator=(FileLeavesStore&& other) = delete;
+    ~FileLeavesStore();
+
+    index_t get_size() const;
+    std::pair<bool, index_t> find_low_value(const bb::fr& new_value) const;
+    indexed_leaf get_leaf(const index_t& index) const;
+    void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index);
+    void append_leaf(const indexed_leaf& leaf);
+
+    /**
+     * @brief Makes the index entries added since the last commit permanent, flushing and merging runs as needed
+     */
+    void commit();
+
+    /**
+     * @brief Discards the leaves and index entries added since the last commit. The FileStore must be rolled back too
+     */
+    void rollback();
+
+  private:
+    // The on-disk form of a value -> index entry; the value is stored as its four little-endian limbs
+    struct IndexEntry {
+        uint64_t value[4];
+        uint64_t index;
+    };
+    using Block = std::vector<IndexEntry>;
+
+    struct Run {
+        uint64_t offset;
+        uint64_t num_entries;
+        std::vector<uint256_t> fences;
+    };
+    class RunWriter;
+
+    void open_index();
+    void flush();
+    void compact();
+    Block read_block(const Run& run, size_t block) const;
+    std::optional<IndexEntry> find_in_run(const Run& run, const uint256_t& value) const;
+
+    FileStore* store_;
+    std::string index_path_;
+    size_t flush_threshold_;
+    int index_fd_;
+    uint64_t index_end_;
+    // The number of leaves whose values are held by the runs
+    uint64_t indexed_leaves_;
+    std::vector<Run> runs_;
+    // Committed entries that have not been flushed to a run yet
+    std::map<uint256_t, index_t> memtable_;
+    // Entries added since the last commit
+    std::map<uint256_t, index_t> pending_;
+    index_t size_;
+    index_t committed_size_;
+    std::unique_ptr<LruCache<uint64_t, std::shared_ptr<const Block>>> cache_;
+};
+
+} // namespace bb::crypto::merkle_tree
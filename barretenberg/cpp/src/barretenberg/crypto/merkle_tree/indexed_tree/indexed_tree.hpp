@@ -1,5 +1,6 @@
 #pragma once
 #include "../../../common/thread.hpp"
+#include "../../../common/throw_or_abort.hpp"
 #include "../append_only_tree/append_only_tree.hpp"
 #include "../hash.hpp"
 #include "../hash_path.hpp"
@@ -65,6 +66,11 @@ template <typename Store, typename LeavesStore, typename HashingPolicy>
 class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
   public:
     IndexedTree(Store& store, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
+    /**
+     * @brief Constructs a tree with the given leaves store, e.g. a persistent one
+     * @details If the store already holds a tree, that tree is restored and initial_size is ignored
+     */
+    IndexedTree(Store& store, LeavesStore leaves, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
     IndexedTree(IndexedTree const& other) = delete;
     IndexedTree(IndexedTree&& other) = delete;
     ~IndexedTree();
@@ -100,6 +106,20 @@ class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
 
     indexed_leaf get_leaf(const index_t& index);
 
+    /**
+     * @brief Commits the nodes and leaves written since the last commit to the stores backing the tree
+     */
+    void commit()
+        requires requires(Store& store, LeavesStore& leaves) {
+            store.commit();
+            leaves.commit();
+        }
+    {
+        // The leaves store's index is derived from the leaves, so it must be committed after the store holding them
+        store_.commit();
+        leaves_.commit();
+    }
+
     using AppendOnlyTree<Store, HashingPolicy>::get_hash_path;
     using AppendOnlyTree<Store, HashingPolicy>::root;
     using AppendOnlyTree<Store, HashingPolicy>::depth;
@@ -131,7 +151,14 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
                                                             size_t depth,
                                                             size_t initial_size,
                                                             uint8_t tree_id)
+    : IndexedTree(store, LeavesStore(), depth, initial_size, tree_id)
+{}
+
+template <typename Store, typename LeavesStore, typename HashingPolicy>
+IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(
+    Store& store, LeavesStore leaves, size_t depth, size_t initial_size, uint8_t tree_id)
     : AppendOnlyTree<Store, HashingPolicy>(store, depth, tree_id)
+    , leaves_(std::move(leaves))
 {
     ASSERT(initial_size > 0);
     zero_hashes_.resize(depth + 1);
@@ -144,6 +171,15 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
         current = HashingPolicy::hash_pair(current, current);
     }
     zero_hashes_[0] = current;
+
+    if (this->size() > 0) {
+        // The tree has been restored from a persistent store, along with its leaves
+        if (leaves_.get_size() != this->size()) {
+            throw_or_abort("IndexedTree: the leaves store does not hold the leaves of the tree");
+        }
+        return;
+    }
+
     // Inserts the initial set of leaves as a chain in incrementing value order
     for (size_t i = 0; i < initial_size; ++i) {
         // Insert the zero leaf to the `leaves` and also to the tree at index 0.
@@ -370,10 +406,22 @@ fr IndexedTree<Store, LeavesStore, HashingPolicy>::append_subtree(const index_t&
     size_t number_to_insert = size_t(index_t(leaves_.get_size()) - index);
     std::vector<fr> hashes_to_append = std::vector<fr>(number_to_insert);
 
+    std::vector<indexed_leaf> leaves(number_to_insert);
     for (size_t i = 0; i < number_to_insert; ++i) {
-        index_t index_to_insert = index + i;
-        hashes_to_append[i] = HashingPolicy::hash(leaves_.get_leaf(size_t(index_to_insert)).get_hash_inputs());
+        leaves[i] = leaves_.get_leaf(index + i);
     }
+    // The leaves are hashed independently, and far more slowly than they are read, so they are split into one chunk
+    // per thread
+    constexpr size_t MIN_HASHES_PER_THREAD = 8;
+    const size_t num_threads = calculate_num_threads(number_to_insert, MIN_HASHES_PER_THREAD);
+    const size_t chunk_size = (number_to_insert + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, number_to_insert);
+        for (size_t i = start; i < end; ++i) {
+            hashes_to_append[i] = HashingPolicy::hash(leaves[i].get_hash_inputs());
+        }
+    });
 
     return AppendOnlyTree<Store, HashingPolicy>::add_values(hashes_to_append);
 }
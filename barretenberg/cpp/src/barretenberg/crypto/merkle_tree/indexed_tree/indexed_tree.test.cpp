@@ -5,7 +5,10 @@
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include "file_leaves_store.hpp"
 #include "leaves_cache.hpp"
+#include <filesystem>
+#include <unistd.h>
 
 using namespace bb;
 using namespace bb::crypto::merkle_tree;
@@ -15,6 +18,25 @@ using HashPolicy = Poseidon2HashPolicy;
 namespace {
 auto& engine = numeric::get_debug_randomness();
 auto& random_engine = numeric::get_randomness();
+
+/**
+ * @brief A file in the temp directory, named after the process and the running test, removed on destruction.
+ */
+struct TempFile {
+    std::string path;
+
+    explicit TempFile(const std::string& extension)
+        : path((std::filesystem::temp_directory_path() /
+                ("bb_" + std::to_string(getpid()) + "_" +
+                 ::testing::UnitTest::GetInstance()->current_test_info()->name() + extension))
+                   .string())
+    {
+        std::filesystem::remove(path);
+    }
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+    ~TempFile() { std::filesystem::remove(path); }
+};
 } // namespace
 
 const size_t NUM_VALUES = 1024;
@@ -131,6 +153,52 @@ TEST(stdlib_indexed_tree, test_batch_insert)
     }
 }
 
+TEST(stdlib_indexed_tree, can_reopen_file_stores)
+{
+    using FileTree = IndexedTree<FileStore, FileLeavesStore, HashPolicy>;
+    const size_t batch_size = 16;
+    const size_t num_batches = 20;
+    const size_t depth = 10;
+    // Flush a run of the low leaf index every other batch, so that the runs get merged along the way
+    const size_t flush_threshold = 24;
+    const TempFile store_file(".dat");
+    const TempFile index_file(".idx");
+    const std::string& store_path = store_file.path;
+    const std::string& index_path = index_file.path;
+
+    NullifierMemoryTree<HashPolicy> memdb(depth, batch_size);
+    auto next_batch = [&](bool committed) {
+        std::vector<fr> batch;
+        for (size_t j = 0; j < batch_size; j++) {
+            batch.push_back(fr(random_engine.get_random_uint256()));
+            if (committed) {
+                memdb.update_element(batch[j]);
+            }
+        }
+        return batch;
+    };
+
+    for (size_t i = 0; i < num_batches; i++) {
+        FileStore store(store_path);
+        FileTree tree(store, FileLeavesStore(store, index_path, flush_threshold), depth, batch_size);
+        EXPECT_EQ(memdb.root(), tree.root());
+
+        tree.add_values(next_batch(true));
+        EXPECT_EQ(memdb.root(), tree.root());
+        tree.commit();
+
+        // Writes that are never committed are lost when the stores are closed
+        tree.add_values(next_batch(false));
+    }
+
+    FileStore store(store_path);
+    FileTree tree(store, FileLeavesStore(store, index_path, flush_threshold), depth, batch_size);
+    EXPECT_EQ(tree.size(), batch_size * (num_batches + 1));
+    EXPECT_EQ(memdb.root(), tree.root());
+    EXPECT_EQ(memdb.get_hash_path(0), tree.get_hash_path(0));
+    EXPECT_EQ(memdb.get_hash_path(100), tree.get_hash_path(100));
+}
+
 fr hash_leaf(const indexed_leaf& leaf)
 {
     return HashPolicy::hash(leaf.get_hash_inputs());
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A thread-safe cache holding at most `capacity` entries, evicting the least recently used one when full
+ */
+template <typename Key, typename Value> class LruCache {
+  public:
+    explicit LruCache(size_t capacity)
+        : capacity_(capacity)
+    {}
+
+    std::optional<Value> get(const Key& key)
+    {
+        std::lock_guard lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        // Move the entry to the front of the list, marking it as the most recently used
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->second;
+    }
+
+    void put(const Key& key, Value value)
+    {
+        std::lock_guard lock(mutex_);
+        if (capacity_ == 0) {
+            return;
+        }
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = std::move(value);
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+        if (entries_.size() == capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        entries_.emplace_front(key, std::move(value));
+        index_.emplace(key, entries_.begin());
+    }
+
+    void clear()
+    {
+        std::lock_guard lock(mutex_);
+        index_.clear();
+        entries_.clear();
+    }
+
+  private:
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    size_t capacity_;
+    Entries entries_;
+    std::unordered_map<Key, typename Entries::iterator> index_;
+    std::mutex mutex_;
+};
+
+} // namespace bb::crypto::merkle_tree
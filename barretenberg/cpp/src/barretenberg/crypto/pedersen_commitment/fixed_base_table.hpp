@@ -0,0 +1,69 @@
+#pragma once
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <vector>
+
+namespace bb::crypto {
+
+/**
+ * @brief Precomputed multiples of a fixed point, used to multiply it by scalars using additions only
+ *
+ * @details A 256-bit scalar is split into NUM_WINDOWS windows of BITS_PER_WINDOW bits. For every window k and every
+ * nonzero digit d, the table stores the affine point d.2^{BITS_PER_WINDOW.k}.[P], so that a scalar multiplication costs
+ * one mixed addition per nonzero window and no doublings, against about 254 doublings and 64 additions for a
+ * variable-base multiplication.
+ *
+ * A table holds NUM_WINDOWS * (2^BITS_PER_WINDOW - 1) affine points, about 0.5MB for Grumpkin, so tables are only built
+ * for the generators of the default commitment and hash contexts. A table is never modified once built and can be read
+ * from any number of threads.
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+
+    static constexpr size_t BITS_PER_WINDOW = 8;
+    static constexpr size_t NUM_WINDOWS = 256 / BITS_PER_WINDOW;
+    static constexpr size_t POINTS_PER_WINDOW = (1UL << BITS_PER_WINDOW) - 1;
+    static_assert(64 % BITS_PER_WINDOW == 0, "windows must not straddle the limbs of a uint256_t");
+
+    explicit FixedBaseTable(const AffineElement& base)
+        : points(NUM_WINDOWS * POINTS_PER_WINDOW)
+    {
+        std::vector<Element> multiples(points.size());
+        Element window_base(base);
+        for (size_t k = 0; k < NUM_WINDOWS; ++k) {
+            Element multiple = window_base;
+            for (size_t d = 0; d < POINTS_PER_WINDOW; ++d) {
+                multiples[k * POINTS_PER_WINDOW + d] = multiple;
+                multiple += window_base;
+            }
+            // multiple is now 2^BITS_PER_WINDOW times the base of this window
+            window_base = multiple;
+        }
+        Element::batch_normalize(multiples.data(), multiples.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            points[i] = AffineElement(multiples[i].x, multiples[i].y);
+        }
+    }
+
+    /**
+     * @brief Add scalar.[P] to the accumulator
+     */
+    void accumulate(Element& accumulator, const uint256_t& scalar) const
+    {
+        constexpr uint64_t DIGIT_MASK = (1UL << BITS_PER_WINDOW) - 1;
+        for (size_t k = 0; k < NUM_WINDOWS; ++k) {
+            const size_t bit = k * BITS_PER_WINDOW;
+            const auto digit = static_cast<size_t>((scalar.data[bit / 64] >> (bit % 64)) & DIGIT_MASK);
+            if (digit != 0) {
+                accumulator += points[k * POINTS_PER_WINDOW + digit - 1];
+            }
+        }
+    }
+
+  private:
+    std::vector<AffineElement> points;
+};
+
+} // namespace bb::crypto
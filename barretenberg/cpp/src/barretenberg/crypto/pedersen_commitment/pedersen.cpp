@@ -2,6 +2,8 @@
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
+#include <memory>
+#include <mutex>
 #ifndef NO_OMP_MULTITHREADING
 #include <omp.h>
 #endif
@@ -21,13 +23,61 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    return commit_native_projective(inputs, context).normalize();
+}
+
+/**
+ * @brief Compute the commitment of commit_native without normalizing it, so that callers can batch the normalization
+ *
+ * @details Commitments using the default generator context are computed with the precomputed fixed-base tables of its
+ * generators, others with variable-base scalar multiplications.
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native_projective(const std::vector<Fq>& inputs,
+                                                                                  const GeneratorContext& context)
+{
     Element result = Group::point_at_infinity;
 
+    const bool is_default_context = context.generators == generator_data<Curve>::get_default_generators() &&
+                                    context.domain_separator == generator_data<Curve>::DEFAULT_DOMAIN_SEPARATOR &&
+                                    context.offset + inputs.size() <= generator_data<Curve>::DEFAULT_NUM_GENERATORS;
+    if (is_default_context) {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            get_default_generator_table(context.offset + i)->accumulate(result, static_cast<uint256_t>(inputs[i]));
+        }
+        return result;
+    }
+
+    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
     for (size_t i = 0; i < inputs.size(); ++i) {
         result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
     }
-    return result.normalize();
+    return result;
 }
+
+/**
+ * @brief Get the fixed-base table of a generator of the default context, building it on first use
+ *
+ * @details Tables are built once per process, and only for the generators that are actually used. The returned table
+ * can be shared between threads.
+ * @return The table, or nullptr if generator_index is not one of the precomputed default generators
+ */
+template <typename Curve>
+const FixedBaseTable<Curve>* pedersen_commitment_base<Curve>::get_default_generator_table(size_t generator_index)
+{
+    constexpr size_t NUM_GENERATORS = generator_data<Curve>::DEFAULT_NUM_GENERATORS;
+    static std::array<std::once_flag, NUM_GENERATORS> init_flags;
+    static std::array<std::unique_ptr<const FixedBaseTable<Curve>>, NUM_GENERATORS> tables;
+
+    if (generator_index >= NUM_GENERATORS) {
+        return nullptr;
+    }
+    std::call_once(init_flags[generator_index], [generator_index] {
+        tables[generator_index] = std::make_unique<const FixedBaseTable<Curve>>(
+            generator_data<Curve>::precomputed_generators[generator_index]);
+    });
+    return tables[generator_index].get();
+}
+
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
@@ -28,6 +28,28 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, FixedBaseTableMatchesScalarMultiplication)
+{
+    using Element = pedersen_commitment::Element;
+    const auto generators = generator_data<curve::Grumpkin>::precomputed_generators;
+    std::vector<pedersen_commitment::Fq> inputs;
+    for (size_t i = 0; i < 4; ++i) {
+        inputs.emplace_back(pedersen_commitment::Fq::random_element());
+    }
+    // Exercise windows holding the top bits and an input with zero windows
+    inputs.emplace_back(-pedersen_commitment::Fq::one());
+    inputs.emplace_back(pedersen_commitment::Fq(uint256_t(1) << 200));
+
+    // Every offset for which the default generators are covered by tables
+    for (size_t offset = 0; offset + inputs.size() <= generators.size(); ++offset) {
+        Element expected = grumpkin::g1::point_at_infinity;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            expected += Element(generators[offset + i]) * static_cast<uint256_t>(inputs[i]);
+        }
+        EXPECT_EQ(pedersen_commitment::commit_native(inputs, offset), pedersen_commitment::AffineElement(expected));
+    }
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
@@ -22,13 +22,11 @@ WASM_EXPORT void pedersen_hashes(fr::vec_in_buf inputs_buffer, uint32_t const* h
     crypto::GeneratorContext<curve::Grumpkin> ctx;
     ctx.offset = static_cast<size_t>(ntohl(*hash_index));
     const size_t numHashes = to_hash.size() / 2;
-    std::vector<grumpkin::fq> results;
-    size_t count = 0;
-    while (count < numHashes) {
-        auto r = crypto::pedersen_hash::hash({ to_hash[count * 2], to_hash[count * 2 + 1] }, ctx);
-        results.push_back(r);
-        ++count;
+    std::vector<std::vector<grumpkin::fq>> pairs(numHashes);
+    for (size_t count = 0; count < numHashes; ++count) {
+        pairs[count] = { to_hash[count * 2], to_hash[count * 2 + 1] };
     }
+    auto results = crypto::pedersen_hash::hash_batch(pairs, ctx);
     write(output, results);
 }
 
@@ -1,5 +1,7 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
 
 namespace bb::crypto {
 
@@ -56,8 +58,61 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    return hash_projective(inputs, context).normalize().x;
+}
+
+/**
+ * @brief Hash many independent vectors of fields at once, using generators from `context` for all of them
+ *
+ * @details The hashes are computed in parallel and normalized with a single batch inversion, so this is much faster
+ * than calling `hash` on every input. Not to be called from within a parallel_for.
+ *
+ * @return The hash of every input, in order
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(const std::vector<std::vector<Fq>>& inputs,
+                                                                             const GeneratorContext context)
+{
+    // Derive any generators that are missing before hashing in parallel, as extending the context is not thread-safe
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    if (max_num_inputs > 0) {
+        static_cast<void>(context.generators->get(max_num_inputs, context.offset, context.domain_separator));
+    }
+
+    std::vector<Element> results(inputs.size());
+    run_loop_in_parallel(inputs.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            results[i] = hash_projective(inputs[i], context);
+        }
+    });
+    Element::batch_normalize(results.data(), results.size());
+
+    std::vector<Fq> hashes(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        hashes[i] = results[i].x;
+    }
+    return hashes;
+}
+
+template <typename Curve>
+typename Curve::Element pedersen_hash_base<Curve>::hash_projective(const std::vector<Fq>& inputs,
+                                                                   const GeneratorContext& context)
+{
+    Element result = pedersen_commitment_base<Curve>::commit_native_projective(inputs, context);
+    get_length_generator_table().accumulate(result, uint256_t(inputs.size()));
+    return result;
+}
+
+/**
+ * @brief The fixed-base table of `length_generator`, built on first use and shared between threads
+ */
+template <typename Curve> const FixedBaseTable<Curve>& pedersen_hash_base<Curve>::get_length_generator_table()
+{
+    static const FixedBaseTable<Curve> table(length_generator);
+    return table;
 }
 
 /**
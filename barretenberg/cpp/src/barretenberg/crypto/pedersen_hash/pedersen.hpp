@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../generators/generator_data.hpp"
+#include "../pedersen_commitment/fixed_base_table.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 namespace bb::crypto {
 /**
@@ -30,9 +31,12 @@ template <typename Curve> class pedersen_hash_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(const std::vector<std::vector<Fq>>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
+    static Element hash_projective(const std::vector<Fq>& inputs, const GeneratorContext& context);
+    static const FixedBaseTable<Curve>& get_length_generator_table();
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
 };
 
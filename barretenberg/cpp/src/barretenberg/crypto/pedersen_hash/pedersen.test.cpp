@@ -21,4 +21,27 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, HashBatch)
+{
+    std::vector<std::vector<pedersen_hash::Fq>> inputs;
+    for (size_t i = 0; i < 64; ++i) {
+        // Sizes beyond the default generators fall back to variable-base multiplications
+        inputs.emplace_back(1 + i % 10);
+        for (auto& x : inputs.back()) {
+            x = pedersen_hash::Fq::random_element();
+        }
+    }
+
+    const auto hashes = pedersen_hash::hash_batch(inputs);
+    const auto hashes_with_index = pedersen_hash::hash_batch(inputs, 5);
+    const pedersen_hash::GeneratorContext context(3, "HASH_BATCH_TEST");
+    const auto hashes_with_domain_separator = pedersen_hash::hash_batch(inputs, context);
+    ASSERT_EQ(hashes.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(hashes[i], pedersen_hash::hash(inputs[i]));
+        EXPECT_EQ(hashes_with_index[i], pedersen_hash::hash(inputs[i], 5));
+        EXPECT_EQ(hashes_with_domain_separator[i], pedersen_hash::hash(inputs[i], context));
+    }
+}
+
 } // namespace bb::crypto
\ No newline at end of file
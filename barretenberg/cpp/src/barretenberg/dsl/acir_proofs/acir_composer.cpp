@@ -9,6 +9,10 @@
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 #include "contract.hpp"
 #include <memory>
+#ifndef __wasm__
+#include <filesystem>
+#include <unistd.h>
+#endif
 
 namespace acir_proofs {
 
@@ -38,9 +42,55 @@ std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key()
     acir_format::Composer composer;
     vinfo("computing proving key...");
     proving_key_ = composer.compute_proving_key(builder_);
+    proving_key_needs_witness_ = false;
     return proving_key_;
 }
 
+/**
+ * @brief Load the proving key stored in key_dir, or compute it and store it there if there is none
+ * @details key_dir must identify the circuit, e.g. by being named after a hash of its bytecode. The polynomials of a
+ * loaded key are memory mapped, so a proof only pays for the witness, see UltraComposer::add_witness_to_proving_key.
+ *
+ * @param key_dir
+ */
+std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key(std::string const& key_dir)
+{
+#ifndef __wasm__
+    std::string const key_path = key_dir + "/proving_key";
+    if (std::filesystem::exists(key_path)) {
+        vinfo("loading proving key from ", key_dir, "...");
+        std::ifstream is(key_path, std::ios::binary);
+        plonk::proving_key_data pk_data;
+        read_from_file(is, key_dir, pk_data);
+        auto crs = srs::get_crs_factory()->get_prover_crs(pk_data.circuit_size + 1);
+        set_proving_key(std::make_shared<plonk::proving_key>(std::move(pk_data), crs));
+        return proving_key_;
+    }
+
+    init_proving_key();
+
+    // Write to a per-process directory and rename it into place, so that concurrent provers never load a partially
+    // written key. If another process got there first, its key is just as good as ours.
+    std::string const tmp_dir = format(key_dir, ".", getpid(), ".tmp");
+    try {
+        std::filesystem::create_directories(tmp_dir);
+        std::ofstream os(tmp_dir + "/proving_key", std::ios::binary);
+        write_to_file(os, tmp_dir, *proving_key_);
+        os.close();
+        std::filesystem::rename(tmp_dir, key_dir);
+        vinfo("proving key written to: ", key_dir);
+    } catch (std::exception const& e) {
+        vinfo("failed to write proving key to ", key_dir, ": ", e.what());
+        std::error_code ec;
+        std::filesystem::remove_all(tmp_dir, ec);
+    }
+    return proving_key_;
+#else
+    static_cast<void>(key_dir);
+    return init_proving_key();
+#endif
+}
+
 std::vector<uint8_t> AcirComposer::create_proof()
 {
     if (!proving_key_) {
@@ -48,6 +98,10 @@ std::vector<uint8_t> AcirComposer::create_proof()
     }
 
     acir_format::Composer composer(proving_key_, nullptr);
+    if (proving_key_needs_witness_) {
+        composer.add_witness_to_proving_key(builder_);
+        proving_key_needs_witness_ = false;
+    }
 
     vinfo("creating proof...");
     std::vector<uint8_t> proof;
@@ -21,10 +21,26 @@ class AcirComposer {
 
     std::shared_ptr<bb::plonk::proving_key> init_proving_key();
 
+    std::shared_ptr<bb::plonk::proving_key> init_proving_key(std::string const& key_dir);
+
+    /**
+     * @brief Use a proving key computed earlier for the same constraint system instead of calling init_proving_key
+     */
+    void set_proving_key(std::shared_ptr<bb::plonk::proving_key> proving_key)
+    {
+        proving_key_ = std::move(proving_key);
+        proving_key_needs_witness_ = true;
+    }
+
     std::vector<uint8_t> create_proof();
 
     void load_verification_key(bb::plonk::verification_key_data&& data);
 
+    void set_verification_key(std::shared_ptr<bb::plonk::verification_key> verification_key)
+    {
+        verification_key_ = std::move(verification_key);
+    }
+
     std::shared_ptr<bb::plonk::verification_key> init_verification_key();
 
     bool verify_proof(std::vector<uint8_t> const& proof);
@@ -42,6 +58,8 @@ class AcirComposer {
     size_t size_hint_;
     std::shared_ptr<bb::plonk::proving_key> proving_key_;
     std::shared_ptr<bb::plonk::verification_key> verification_key_;
+    // Whether proving_key_ holds the witness of another circuit, see UltraComposer::add_witness_to_proving_key
+    bool proving_key_needs_witness_ = false;
     bool verbose_ = true;
 
     template <typename... Args> inline void vinfo(Args... args)
@@ -360,6 +360,26 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, BatchInvertSkipsZeros)
+{
+    // Enough elements to span several chunks, with zeros around the boundaries of the words of the skip mask
+    size_t n = 5000;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 64 == 0 || i % 64 == 63 || i % 7 == 0) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> sequential = coeffs;
+    std::vector<fr> parallel = coeffs;
+    fr::batch_invert(sequential);
+    fr::parallel_batch_invert(parallel);
+
+    for (size_t i = 0; i < n; ++i) {
+        fr expected = coeffs[i].is_zero() ? fr::zero() : coeffs[i].invert();
+        EXPECT_EQ(sequential[i], expected);
+        EXPECT_EQ(parallel[i], expected);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
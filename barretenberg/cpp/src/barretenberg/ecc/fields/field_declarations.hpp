@@ -252,6 +252,12 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Batch invert with the coefficients split across threads, each chunk being inverted on its own
+     * @details Zero coefficients are left as they are. Not to be called from within a parallel_for: callers that
+     * already split their work across threads should call batch_invert on their own part instead.
+     */
+    static void parallel_batch_invert(std::span<field> coeffs) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -1,9 +1,11 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <memory>
 #include <span>
 #include <type_traits>
@@ -404,44 +406,35 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::batch_invert");
     const size_t n = coeffs.size();
+    constexpr size_t BITS_PER_WORD = 64;
+    const size_t num_words = (n + BITS_PER_WORD - 1) / BITS_PER_WORD;
 
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
-    auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
+    // One bit per coefficient, set for the zero coefficients, which are skipped
+    auto skipped_ptr = std::static_pointer_cast<uint64_t[]>(get_mem_slab(num_words * sizeof(uint64_t)));
     auto temporaries = temporaries_ptr.get();
     auto* skipped = skipped_ptr.get();
 
     field accumulator = one();
-    for (size_t i = 0; i < n; ++i) {
-        temporaries[i] = accumulator;
-        if (coeffs[i].is_zero()) {
-            skipped[i] = true;
-        } else {
-            skipped[i] = false;
-            accumulator *= coeffs[i];
+    for (size_t word = 0; word < num_words; ++word) {
+        uint64_t mask = 0;
+        const size_t end = std::min(n, (word + 1) * BITS_PER_WORD);
+        for (size_t i = word * BITS_PER_WORD; i < end; ++i) {
+            temporaries[i] = accumulator;
+            if (coeffs[i].is_zero()) {
+                mask |= 1ULL << (i % BITS_PER_WORD);
+            } else {
+                accumulator *= coeffs[i];
+            }
         }
+        skipped[word] = mask;
     }
 
-    // std::vector<field> temporaries;
-    // std::vector<bool> skipped;
-    // temporaries.reserve(n);
-    // skipped.reserve(n);
-
-    // field accumulator = one();
-    // for (size_t i = 0; i < n; ++i) {
-    //     temporaries.emplace_back(accumulator);
-    //     if (coeffs[i].is_zero()) {
-    //         skipped.emplace_back(true);
-    //     } else {
-    //         skipped.emplace_back(false);
-    //         accumulator *= coeffs[i];
-    //     }
-    // }
-
     accumulator = accumulator.invert();
 
     field T0;
     for (size_t i = n - 1; i < n; --i) {
-        if (!skipped[i]) {
+        if (((skipped[i / BITS_PER_WORD] >> (i % BITS_PER_WORD)) & 1) == 0) {
             T0 = accumulator * temporaries[i];
             accumulator *= coeffs[i];
             coeffs[i] = T0;
@@ -449,6 +442,20 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs) noexcept
+{
+    // Every chunk costs an inversion, i.e. a few hundred multiplications, against ~3 multiplications per element
+    constexpr size_t MIN_ELEMENTS_PER_THREAD = 1 << 10;
+    const size_t n = coeffs.size();
+    const size_t num_threads = calculate_num_threads(n, MIN_ELEMENTS_PER_THREAD);
+    const size_t chunk_size = (n + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * chunk_size, n);
+        const size_t end = std::min(start + chunk_size, n);
+        batch_invert(coeffs.subspan(start, end - start));
+    });
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::tonelli_shanks_sqrt");
@@ -1,8 +1,10 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
@@ -946,6 +948,146 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
     return pippenger(scalars, points, num_initial_points, state, false);
 }
 
+/**
+ * @brief Multi-scalar multiplication for scalars of at most `max_scalar_bits` bits
+ *
+ * @details Each thread adds every point into the bucket indexed by its scalar, then weights the buckets with a running
+ * sum: ∑ᵥ v⋅Bᵥ = ∑ᵥ ∑_{w ≥ v} B_w. This costs one mixed addition per nonzero scalar plus 2^(max_scalar_bits + 1)
+ * additions per thread, in a single round, where pippenger would run all of its rounds over the full width scalars.
+ * Zero scalars are skipped.
+ *
+ * @param points pippenger point table, i.e. points[2 * i] is the point paired with scalars[i]
+ */
+template <typename Curve>
+typename Curve::Element small_scalar_mul(const typename Curve::ScalarField* scalars,
+                                         const typename Curve::AffineElement* points,
+                                         const size_t num_initial_points,
+                                         const size_t max_scalar_bits)
+{
+    using Element = typename Curve::Element;
+    ASSERT(max_scalar_bits <= MAX_SMALL_SCALAR_BITS);
+
+    if (max_scalar_bits == 0) {
+        Element out = Curve::Group::one;
+        out.self_set_infinity();
+        return out;
+    }
+
+    const size_t num_buckets = 1UL << max_scalar_bits;
+    const size_t num_threads = calculate_num_threads(num_initial_points, num_buckets * 4);
+    const size_t points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+    std::vector<Element> thread_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * points_per_thread, num_initial_points);
+        const size_t end = std::min(start + points_per_thread, num_initial_points);
+
+        std::vector<Element> buckets(num_buckets);
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        for (size_t i = start; i < end; ++i) {
+            const uint64_t value = scalars[i].from_montgomery_form().data[0];
+            if (value != 0) {
+                buckets[value] += points[i * 2];
+            }
+        }
+
+        Element running_sum = buckets[num_buckets - 1];
+        Element result = running_sum;
+        for (size_t value = num_buckets - 2; value > 0; --value) {
+            running_sum += buckets[value];
+            result += running_sum;
+        }
+        thread_results[thread_idx] = result;
+    });
+
+    Element result = thread_results[0];
+    for (size_t i = 1; i < num_threads; ++i) {
+        result += thread_results[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Pippenger that first scans the scalars and takes a cheaper route for sparse or small scalars
+ *
+ * @details The scan records the number of zero scalars and the largest scalar bit length. If every scalar fits in
+ * MAX_SMALL_SCALAR_BITS (e.g. selector-like 0/1 columns, or all zero), small_scalar_mul is used. Otherwise, if enough
+ * scalars are zero, the nonzero scalars and their point pairs are compacted and pippenger runs over those only. Dense
+ * inputs fall through to pippenger_unsafe, at the cost of the scan, which is small next to the MSM itself.
+ *
+ * As with pippenger_unsafe, the points must not contain duplicates or the point at infinity.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_sparse_aware(typename Curve::ScalarField* scalars,
+                                                      typename Curve::AffineElement* points,
+                                                      const size_t num_initial_points,
+                                                      pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+    using AffineElement = typename Curve::AffineElement;
+
+    if (num_initial_points <= get_num_cpus_pow2() * 8) {
+        return pippenger_unsafe(scalars, points, num_initial_points, state);
+    }
+
+    const size_t num_threads = calculate_num_threads(num_initial_points);
+    const size_t points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+    std::vector<size_t> thread_nonzero_counts(num_threads, 0);
+    std::vector<size_t> thread_max_bits(num_threads, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * points_per_thread, num_initial_points);
+        const size_t end = std::min(start + points_per_thread, num_initial_points);
+        size_t nonzero_count = 0;
+        uint64_t high_limbs = 0;
+        uint64_t low_limb = 0;
+        for (size_t i = start; i < end; ++i) {
+            const Fr scalar = scalars[i].from_montgomery_form();
+            const bool nonzero = (scalar.data[0] | scalar.data[1] | scalar.data[2] | scalar.data[3]) != 0;
+            nonzero_count += static_cast<size_t>(nonzero);
+            high_limbs |= scalar.data[1] | scalar.data[2] | scalar.data[3];
+            low_limb |= scalar.data[0];
+        }
+        thread_nonzero_counts[thread_idx] = nonzero_count;
+        // An upper bound on the bit length suffices, so OR-ing the scalars together avoids a get_msb per scalar
+        thread_max_bits[thread_idx] =
+            high_limbs != 0 ? 256 : (low_limb == 0 ? 0 : static_cast<size_t>(numeric::get_msb(low_limb)) + 1);
+    });
+
+    const size_t max_scalar_bits = *std::max_element(thread_max_bits.begin(), thread_max_bits.end());
+    if (max_scalar_bits <= MAX_SMALL_SCALAR_BITS) {
+        return small_scalar_mul<Curve>(scalars, points, num_initial_points, max_scalar_bits);
+    }
+
+    size_t num_nonzero = 0;
+    std::vector<size_t> thread_offsets(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        thread_offsets[i] = num_nonzero;
+        num_nonzero += thread_nonzero_counts[i];
+    }
+    if ((num_initial_points - num_nonzero) * SPARSE_COMPACTION_RATIO < num_initial_points) {
+        return pippenger_unsafe(scalars, points, num_initial_points, state);
+    }
+
+    std::vector<Fr> compact_scalars(num_nonzero);
+    std::vector<AffineElement> compact_points(num_nonzero * 2);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * points_per_thread, num_initial_points);
+        const size_t end = std::min(start + points_per_thread, num_initial_points);
+        size_t offset = thread_offsets[thread_idx];
+        for (size_t i = start; i < end; ++i) {
+            if (!scalars[i].is_zero()) {
+                compact_scalars[offset] = scalars[i];
+                compact_points[offset * 2] = points[i * 2];
+                compact_points[offset * 2 + 1] = points[i * 2 + 1];
+                ++offset;
+            }
+        }
+    });
+    return pippenger_unsafe(compact_scalars.data(), compact_points.data(), num_nonzero, state);
+}
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -1003,6 +1145,17 @@ template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::Scal
                                                               const size_t num_initial_points,
                                                               pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element small_scalar_mul<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                              const curve::BN254::AffineElement* points,
+                                                              const size_t num_initial_points,
+                                                              const size_t max_scalar_bits);
+
+template curve::BN254::Element pippenger_unsafe_sparse_aware<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
     curve::BN254::AffineElement* points,
@@ -1054,6 +1207,17 @@ template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grump
                                                                     const size_t num_initial_points,
                                                                     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element small_scalar_mul<curve::Grumpkin>(const curve::Grumpkin::ScalarField* scalars,
+                                                                    const curve::Grumpkin::AffineElement* points,
+                                                                    const size_t num_initial_points,
+                                                                    const size_t max_scalar_bits);
+
+template curve::Grumpkin::Element pippenger_unsafe_sparse_aware<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
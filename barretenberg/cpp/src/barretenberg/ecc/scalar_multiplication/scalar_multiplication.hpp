@@ -164,6 +164,29 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          size_t num_initial_points,
                                          pippenger_runtime_state<Curve>& state);
 
+/**
+ * @brief Scalars at or below this bit length are multiplied by bucketing points on their value, see small_scalar_mul
+ */
+constexpr size_t MAX_SMALL_SCALAR_BITS = 8;
+
+/**
+ * @brief Scalars of an MSM are compacted before running pippenger once at least 1/SPARSE_COMPACTION_RATIO of them are
+ * zero. The wNAF form of a zero scalar is not zero, so pippenger spends as much on a zero scalar as on any other.
+ */
+constexpr size_t SPARSE_COMPACTION_RATIO = 16;
+
+template <typename Curve>
+typename Curve::Element small_scalar_mul(const typename Curve::ScalarField* scalars,
+                                         const typename Curve::AffineElement* points,
+                                         size_t num_initial_points,
+                                         size_t max_scalar_bits);
+
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_sparse_aware(typename Curve::ScalarField* scalars,
+                                                      typename Curve::AffineElement* points,
+                                                      size_t num_initial_points,
+                                                      pippenger_runtime_state<Curve>& state);
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -106,6 +106,9 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
     bool contains_recursive_proof;
     std::vector<uint32_t> recursive_proof_public_input_indices;
     bb::EvaluationDomain<FF> evaluation_domain;
+    // Row of the first public input and hash of the circuit structure the precomputed polynomials were computed for
+    size_t pub_inputs_offset = 0;
+    uint64_t circuit_hash = 0;
 
     std::vector<std::string> get_labels() const
     {
@@ -115,6 +118,7 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
     auto get_all() { return concatenate(get_precomputed_polynomials(), get_witness_polynomials()); }
     auto get_witness_polynomials() { return WitnessPolynomials::get_all(); }
     auto get_precomputed_polynomials() { return PrecomputedPolynomials::get_all(); }
+    std::vector<std::string> get_precomputed_labels() const { return PrecomputedPolynomials::get_labels(); }
     auto get_selectors() { return PrecomputedPolynomials::get_selectors(); }
     ProvingKey_() = default;
     ProvingKey_(const size_t circuit_size, const size_t num_public_inputs)
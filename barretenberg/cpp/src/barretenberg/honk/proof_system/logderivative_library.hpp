@@ -1,8 +1,22 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <span>
+#include <tuple>
 #include <typeinfo>
 
 namespace bb {
 
+/**
+ * @brief Relations that expose the tuple of entities they read, in which case rows only need those entities populated
+ */
+template <typename Relation, typename Polynomials, typename Row>
+concept HasRowEntities = requires(const Polynomials& polynomials, Row& row) {
+    Relation::get_const_entities(polynomials);
+    Relation::get_nonconst_entities(row);
+};
+
 /**
  * @brief Compute the inverse polynomial I(X) required for logderivative lookups
  * *
@@ -21,40 +35,64 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are split into one contiguous chunk per thread, and each thread batch-inverts its own chunk. If the relation
+ * exposes the entities it reads (see HasRowEntities), only those are copied into the row; otherwise the full row is
+ * fetched with get_row.
+ *
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
 {
     using FF = typename Flavor::FF;
     using Accumulator = typename Relation::ValueAccumulator0;
+    using Row = decltype(polynomials.get_row(0));
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto lookup_relation = Relation();
 
     auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        auto row = polynomials.get_row(i);
-        bool has_inverse = lookup_relation.operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+
+    const size_t num_threads = calculate_num_threads(circuit_size);
+    const size_t rows_per_thread = (circuit_size + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * rows_per_thread, circuit_size);
+        const size_t end = std::min(start + rows_per_thread, circuit_size);
+        if (start == end) {
+            return;
         }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial[i] = denominator;
-    };
-
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+
+        Row row{};
+        for (size_t i = start; i < end; ++i) {
+            if constexpr (HasRowEntities<Relation, Polynomials, Row>) {
+                auto row_entities = Relation::get_nonconst_entities(row);
+                const auto polynomial_entities = Relation::get_const_entities(polynomials);
+                bb::constexpr_for<0, std::tuple_size_v<decltype(row_entities)>, 1>(
+                    [&]<size_t k> { std::get<k>(row_entities) = std::get<k>(polynomial_entities)[i]; });
+            } else {
+                row = polynomials.get_row(i);
+            }
+            bool has_inverse = lookup_relation.operation_exists_at_row(row);
+            if (!has_inverse) {
+                continue;
+            }
+            FF denominator = 1;
+            bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                auto denominator_term =
+                    lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                auto denominator_term =
+                    lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                denominator *= denominator_term;
+            });
+            inverse_polynomial[i] = denominator;
+        }
+
+        // todo might be inverting zero in field bleh bleh
+        FF::batch_invert(std::span{ &inverse_polynomial[start], end - start });
+    });
 }
 
 /**
@@ -18,22 +18,36 @@ namespace bb::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
-    for (size_t i = 0; i < selector_properties.size(); i++) {
-        // Compute monomial form of selector polynomial
+    const size_t num_selectors = selector_properties.size();
+    std::vector<bb::polynomial> selector_polys;
+    std::vector<bb::polynomial> selector_polys_fft;
+    selector_polys.reserve(num_selectors);
+    selector_polys_fft.reserve(num_selectors);
+
+    // Compute monomial form of the selector polynomials
+    std::vector<bb::fr*> coefficients;
+    for (size_t i = 0; i < num_selectors; i++) {
         auto selector_poly_lagrange =
             circuit_proving_key->polynomial_store.get(selector_properties[i].name + "_lagrange");
-        bb::polynomial selector_poly(circuit_proving_key->circuit_size);
-        bb::polynomial_arithmetic::ifft(
-            &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
+        selector_polys.emplace_back(selector_poly_lagrange, circuit_proving_key->circuit_size);
+        coefficients.emplace_back(&selector_polys.back()[0]);
+    }
+    bb::polynomial_arithmetic::ifft_batch<bb::fr>(coefficients, circuit_proving_key->small_domain);
 
-        // Compute coset FFT of selector polynomial
-        bb::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+    // Compute coset FFT of the selector polynomials
+    coefficients.clear();
+    for (size_t i = 0; i < num_selectors; i++) {
+        selector_polys_fft.emplace_back(selector_polys[i], circuit_proving_key->circuit_size * 4 + 4);
+        coefficients.emplace_back(&selector_polys_fft.back()[0]);
+    }
+    bb::polynomial_arithmetic::coset_fft_batch<bb::fr>(coefficients, circuit_proving_key->large_domain);
 
+    for (size_t i = 0; i < num_selectors; i++) {
         // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
         // is not the case for Ultra.
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_polys[i]));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                  std::move(selector_polys_fft[i]));
     }
 }
 
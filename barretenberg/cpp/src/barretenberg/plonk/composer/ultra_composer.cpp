@@ -1,4 +1,5 @@
 #include "ultra_composer.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/plonk/composer/composer_lib.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
 #include "barretenberg/plonk/proof_system/types/program_settings.hpp"
@@ -193,6 +194,33 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
     return circuit_proving_key;
 }
 
+/**
+ * @brief Place the witness of a circuit into a proving key computed for a circuit of the same structure
+ * @details compute_proving_key stores the wires and sorted lookup polynomials of the circuit it is given in the proving
+ * key alongside the selectors, sigmas and tables. A key reused for a new witness, e.g. one loaded from disk, only needs
+ * the former to be recomputed, since the latter depend on the circuit structure alone.
+ */
+void UltraComposer::add_witness_to_proving_key(CircuitBuilder& circuit)
+{
+    circuit.finalize_circuit();
+
+    const size_t subgroup_size = compute_dyadic_circuit_size(circuit);
+    if (subgroup_size != circuit_proving_key->circuit_size ||
+        circuit.public_inputs.size() != circuit_proving_key->num_public_inputs) {
+        throw_or_abort("Proving key was computed for a different circuit.");
+    }
+
+    Trace::generate_wires(circuit, circuit_proving_key);
+
+    // A key read from disk lacks the placeholders for these, see compute_proving_key.
+    if (!circuit_proving_key->polynomial_store.contains("z_lookup_fft")) {
+        circuit_proving_key->polynomial_store.put("z_lookup_fft", polynomial(subgroup_size * 4));
+        circuit_proving_key->polynomial_store.put("s_fft", polynomial(subgroup_size * 4));
+    }
+
+    construct_sorted_polynomials(circuit, subgroup_size);
+}
+
 /**
  * Compute verification key consisting of selector precommitments.
  *
@@ -71,6 +71,7 @@ class UltraComposer {
     [[nodiscard]] size_t get_num_selectors() { return ultra_selector_properties().size(); }
 
     std::shared_ptr<plonk::proving_key> compute_proving_key(CircuitBuilder& circuit_constructor);
+    void add_witness_to_proving_key(CircuitBuilder& circuit_constructor);
     std::shared_ptr<plonk::verification_key> compute_verification_key(CircuitBuilder& circuit_constructor);
 
     UltraProver create_prover(CircuitBuilder& circuit_constructor);
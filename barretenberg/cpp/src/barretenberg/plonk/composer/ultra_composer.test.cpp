@@ -1,9 +1,12 @@
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/uintx/uintx.hpp"
 #include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/plonk/proof_system/widgets/random_widgets/plookup_widget.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 #include "barretenberg/proof_system/plookup_tables/sha256.hpp"
@@ -122,6 +125,59 @@ TYPED_TEST(ultra_plonk_composer, create_gates_from_plookup_accumulators)
     TestFixture::prove_and_verify(circuit_builder, /*expected_result=*/true);
 }
 
+TYPED_TEST(ultra_plonk_composer, prove_with_proving_key_from_file)
+{
+    // Circuits of identical structure that differ only in their witness
+    auto create_circuit = [](uint32_t left_value, uint32_t right_value) {
+        auto builder = UltraCircuitBuilder();
+        fr left_witness_value = fr{ left_value, 0, 0, 0 }.to_montgomery_form();
+        fr right_witness_value = fr{ right_value, 0, 0, 0 }.to_montgomery_form();
+        uint32_t left_witness_index = builder.add_public_variable(left_witness_value);
+        uint32_t right_witness_index = builder.add_variable(right_witness_value);
+        const auto lookup_accumulators =
+            plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, left_witness_value, right_witness_value, true);
+        builder.create_gates_from_plookup_accumulators(
+            MultiTableId::UINT32_XOR, lookup_accumulators, left_witness_index, right_witness_index);
+        return builder;
+    };
+    // Unique per process so that concurrent runs of the test do not share the key
+    const std::string key_dir = (std::filesystem::temp_directory_path() /
+                                 ("bb_" + std::to_string(getpid()) + "_" +
+                                  ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+                                    .string();
+    std::filesystem::create_directories(key_dir);
+
+    auto first_builder = create_circuit(engine.get_random_uint32(), engine.get_random_uint32());
+    auto composer = UltraComposer();
+    auto proving_key = composer.compute_proving_key(first_builder);
+    {
+        std::ofstream os(key_dir + "/proving_key", std::ios::binary);
+        write_to_file(os, key_dir, *proving_key);
+    }
+
+    std::ifstream is(key_dir + "/proving_key", std::ios::binary);
+    proving_key_data pk_data;
+    read_from_file(is, key_dir, pk_data);
+    auto crs = srs::get_crs_factory()->get_prover_crs(pk_data.circuit_size + 1);
+    auto loaded_key = std::make_shared<plonk::proving_key>(std::move(pk_data), crs);
+
+    // Prove a new witness with the loaded key and verify against the verification key of the original circuit
+    auto second_builder = create_circuit(engine.get_random_uint32(), engine.get_random_uint32());
+    auto second_composer = UltraComposer(loaded_key, nullptr);
+    second_composer.add_witness_to_proving_key(second_builder);
+    if constexpr (TypeParam::use_keccak) {
+        auto verifier = composer.create_ultra_with_keccak_verifier(first_builder);
+        auto prover = second_composer.create_ultra_with_keccak_prover(second_builder);
+        EXPECT_TRUE(verifier.verify_proof(prover.construct_proof()));
+    } else {
+        auto verifier = composer.create_verifier(first_builder);
+        auto prover = second_composer.create_prover(second_builder);
+        EXPECT_TRUE(verifier.verify_proof(prover.construct_proof()));
+    }
+
+    std::filesystem::remove_all(key_dir);
+}
+
 TYPED_TEST(ultra_plonk_composer, test_no_lookup_proof)
 {
     auto builder = UltraCircuitBuilder();
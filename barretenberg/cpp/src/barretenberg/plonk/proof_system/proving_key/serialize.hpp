@@ -81,24 +81,8 @@ template <typename B> inline void read_from_file(B& is, std::string const& path,
         read(is, name);
         std::string filepath = format(path, "/", file_num++, "_", name);
 
-        struct stat st;
-        if (stat(filepath.c_str(), &st) != 0) {
-            throw_or_abort("Filename not found: " + filepath);
-        }
-        size_t file_size = (size_t)st.st_size;
-        size_t num_fields = file_size / 32;
-        bb::polynomial value(num_fields);
-
-        // Open the file and read the data directly into the polynomial memory.
-        std::ifstream file(filepath, std::ios::binary);
-        if (file) {
-            file.read(reinterpret_cast<char*>(value.data().get()), (std::streamsize)file_size);
-            file.close();
-        } else {
-            throw_or_abort("Failed to open file: " + filepath);
-        }
-
-        key.polynomial_store.put(name, std::move(value));
+        // Map the file rather than reading it, so only the pages the prover touches are loaded.
+        key.polynomial_store.put(name, bb::polynomial::map_file(filepath));
     }
     read(is, key.contains_recursive_proof);
     read(is, key.recursive_proof_public_input_indices);
@@ -1,4 +1,6 @@
 #include "work_queue.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/timer.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -198,87 +200,135 @@ void work_queue::add_to_queue(const work_item& item)
     // #endif
 }
 
+/**
+ * @brief Process all queued work items, grouped by type
+ *
+ * @details An FFT needs the monomial form of its wire, which an IFFT queued in the same round may produce, while the
+ * scalars of a scalar multiplication are fixed when it is queued. So all IFFTs run first, followed by all FFTs, and
+ * the scalar multiplications run last, in queue order. The IFFTs and the FFTs each run as one batch, in which a thread
+ * transforms whole polynomials as long as there are enough of them, instead of every transform synchronising all
+ * threads after each of its rounds. The groups still run one after the other, each using every thread; nothing runs
+ * concurrently with the scalar multiplications.
+ */
 void work_queue::process_queue()
 {
+    std::vector<const work_item*> iffts;
+    std::vector<const work_item*> ffts;
+    std::vector<const work_item*> scalar_multiplications;
     for (const auto& item : work_item_queue) {
         switch (item.work_type) {
+        case WorkType::IFFT: {
+            iffts.emplace_back(&item);
+            break;
+        }
+        case WorkType::FFT: {
+            ffts.emplace_back(&item);
+            break;
+        }
         // most expensive op
         case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+            scalar_multiplications.emplace_back(&item);
+            break;
+        }
+        // SMALL_FFT items are not processed, see add_to_queue
+        default: {
+        }
+        }
+    }
 
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
+    timing_trace.clear();
+    process_iffts(iffts);
+    process_ffts(ffts);
+    for (const auto* item : scalar_multiplications) {
+        Timer timer;
+        process_scalar_multiplication(*item);
+        timing_trace.push_back({ item->work_type, item->tag, timer.nanoseconds() });
+    }
 
-            bb::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+#ifdef DEBUG_TIMING
+    for (const auto& timing : timing_trace) {
+        info("work item ", timing.tag, ": ", timing.nanoseconds / 1000000, "ms");
+    }
+#endif
+    work_item_queue = std::vector<work_item>();
+}
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+// 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+void work_queue::process_iffts(const std::vector<const work_item*>& items)
+{
+    if (items.empty()) {
+        return;
+    }
+    Timer timer;
 
-            transcript->add_element(item.tag, result.to_buffer());
+    // Compute wire monomial forms via ifft on the lagrange forms then add them to the store
+    std::vector<bb::polynomial> wire_monomials;
+    std::vector<fr*> coefficients;
+    wire_monomials.reserve(items.size());
+    for (const auto* item : items) {
+        auto wire_lagrange = key->polynomial_store.get(item->tag + "_lagrange");
+        auto& wire_monomial = wire_monomials.emplace_back(key->circuit_size);
+        polynomial_arithmetic::copy_polynomial(
+            &wire_lagrange[0], &wire_monomial[0], key->circuit_size, key->circuit_size);
+        coefficients.emplace_back(&wire_monomial[0]);
+    }
+    polynomial_arithmetic::ifft_batch<fr>(coefficients, key->small_domain);
+    for (size_t i = 0; i < items.size(); ++i) {
+        key->polynomial_store.put(items[i]->tag, std::move(wire_monomials[i]));
+    }
 
-            break;
+    const int64_t nanoseconds = timer.nanoseconds() / static_cast<int64_t>(items.size());
+    for (const auto* item : items) {
+        timing_trace.push_back({ item->work_type, item->tag, nanoseconds });
+    }
+}
+
+// About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
+// due to the need to copy memory between web workers
+void work_queue::process_ffts(const std::vector<const work_item*>& items)
+{
+    if (items.empty()) {
+        return;
+    }
+    Timer timer;
+
+    std::vector<bb::polynomial> wire_ffts;
+    std::vector<fr*> coefficients;
+    wire_ffts.reserve(items.size());
+    for (const auto* item : items) {
+        auto wire = key->polynomial_store.get(item->tag);
+        auto& wire_fft = wire_ffts.emplace_back(wire, 4 * key->circuit_size + 4);
+        coefficients.emplace_back(&wire_fft[0]);
+    }
+    polynomial_arithmetic::coset_fft_batch<fr>(coefficients, key->large_domain);
+    for (size_t i = 0; i < items.size(); ++i) {
+        for (size_t j = 0; j < 4; j++) {
+            wire_ffts[i][4 * key->circuit_size + j] = wire_ffts[i][j];
         }
-        // Commenting this out as per above.
-        // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
-        // due to the need to copy memory between web workers
-        // case WorkType::SMALL_FFT: {
-        //     using namespace bb;
-        //     const size_t n = key->circuit_size;
-        //     auto wire = key->polynomial_store.get(item.tag);
-
-        //     polynomial wire_copy(wire, n);
-        //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
-
-        //     if (item.index != 0) {
-        //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
-        //         for (size_t i = 0; i < n; ++i) {
-        //             old_wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         old_wire_fft[4 * n + item.index] = wire_copy[0];
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
-        //     } else {
-        //         polynomial wire_fft(4 * n + 4);
-        //         for (size_t i = 0; i < n; ++i) {
-        //             wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-        //     }
-        //     break;
-        // }
-        case WorkType::FFT: {
-            using namespace bb;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
+        key->polynomial_store.put(items[i]->tag + "_fft", std::move(wire_ffts[i]));
+    }
 
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
+    const int64_t nanoseconds = timer.nanoseconds() / static_cast<int64_t>(items.size());
+    for (const auto* item : items) {
+        timing_trace.push_back({ item->work_type, item->tag, nanoseconds });
+    }
+}
+
+void work_queue::process_scalar_multiplication(const work_item& item)
+{
+    // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+    auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
 
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            break;
-        }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace bb;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+    bb::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
 
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
+    // Run pippenger multi-scalar multiplication.
+    auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
+    bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
+        item.mul_scalars.get(), srs_points, msm_size, runtime_state));
 
-            break;
-        }
-        default: {
-        }
-        }
-    }
-    work_item_queue = std::vector<work_item>();
+    transcript->add_element(item.tag, result.to_buffer());
 }
 
 std::vector<work_queue::work_item> work_queue::get_queue() const
@@ -32,6 +32,16 @@ class work_queue {
         bb::fr shift_factor;
     };
 
+    /**
+     * @brief The time spent on a work item by the last call to process_queue
+     * @details Independent items of the same type are processed as one batch, whose time is split evenly between them
+     */
+    struct work_item_timing {
+        WorkType work_type;
+        std::string tag;
+        int64_t nanoseconds;
+    };
+
     work_queue(proving_key* prover_key = nullptr, transcript::StandardTranscript* prover_transcript = nullptr);
 
     work_queue(const work_queue& other) = default;
@@ -63,9 +73,18 @@ class work_queue {
 
     std::vector<work_item> get_queue() const;
 
+    const std::vector<work_item_timing>& get_timing_trace() const { return timing_trace; }
+
   private:
+    void process_iffts(const std::vector<const work_item*>& items);
+
+    void process_ffts(const std::vector<const work_item*>& items);
+
+    void process_scalar_multiplication(const work_item& item);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    std::vector<work_item_timing> timing_trace;
 };
 } // namespace bb::plonk
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "work_queue.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::plonk;
+
+/**
+ * @brief The queue is processed in dependency order: the FFTs of wires, queued before the IFFTs that produce their
+ * monomial forms, still transform the IFFT results
+ */
+TEST(work_queue, ProcessesItemsInDependencyOrder)
+{
+    constexpr size_t n = 256;
+    constexpr size_t num_wires = 4;
+    auto file_crs = std::make_shared<bb::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    auto crs = file_crs->get_prover_crs(n + 1);
+    auto key = std::make_shared<proving_key>(n, 0, crs, CircuitType::ULTRA);
+    transcript::StandardTranscript transcript{ transcript::Manifest() };
+    work_queue queue(key.get(), &transcript);
+
+    for (size_t i = 0; i < num_wires; ++i) {
+        polynomial wire_lagrange(n);
+        for (auto& coeff : wire_lagrange) {
+            coeff = fr::random_element();
+        }
+        key->polynomial_store.put("w_" + std::to_string(i + 1) + "_lagrange", std::move(wire_lagrange));
+    }
+    polynomial scalars(n);
+    for (auto& coeff : scalars) {
+        coeff = fr::random_element();
+    }
+
+    for (size_t i = 0; i < num_wires; ++i) {
+        queue.add_to_queue({
+            .work_type = work_queue::WorkType::FFT,
+            .mul_scalars = nullptr,
+            .tag = "w_" + std::to_string(i + 1),
+            .constant = fr(0),
+            .index = 0,
+        });
+    }
+    queue.add_to_queue({
+        .work_type = work_queue::WorkType::SCALAR_MULTIPLICATION,
+        .mul_scalars = scalars.data(),
+        .tag = "C",
+        .constant = fr(n),
+        .index = 0,
+    });
+    for (size_t i = 0; i < num_wires; ++i) {
+        queue.add_to_queue({
+            .work_type = work_queue::WorkType::IFFT,
+            .mul_scalars = nullptr,
+            .tag = "w_" + std::to_string(i + 1),
+            .constant = fr(0),
+            .index = 0,
+        });
+    }
+    queue.process_queue();
+
+    for (size_t i = 0; i < num_wires; ++i) {
+        const std::string tag = "w_" + std::to_string(i + 1);
+        polynomial expected_monomial(key->polynomial_store.get(tag + "_lagrange"), n);
+        expected_monomial.ifft(key->small_domain);
+        polynomial expected_fft(expected_monomial, 4 * n + 4);
+        expected_fft.coset_fft(key->large_domain);
+        for (size_t j = 0; j < 4; ++j) {
+            expected_fft[4 * n + j] = expected_fft[j];
+        }
+        EXPECT_EQ(key->polynomial_store.get(tag), expected_monomial);
+        EXPECT_EQ(key->polynomial_store.get(tag + "_fft"), expected_fft);
+    }
+
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(n);
+    g1::affine_element expected_commitment(scalar_multiplication::pippenger_unsafe<curve::BN254>(
+        &scalars[0], crs->get_monomial_points(), n, state));
+    EXPECT_EQ(transcript.get_element("C"), expected_commitment.to_buffer());
+
+    // Every processed item is timed
+    const auto& timing_trace = queue.get_timing_trace();
+    EXPECT_EQ(timing_trace.size(), 2 * num_wires + 1);
+    for (const auto& timing : timing_trace) {
+        EXPECT_GE(timing.nanoseconds, 0);
+    }
+    EXPECT_TRUE(queue.get_queue().empty());
+}
@@ -229,6 +229,69 @@ template <class Fr, size_t domain_end, size_t num_evals, size_t domain_start = 0
     inline static const auto full_numerator_values = construct_full_numerator_values(big_domain);
 };
 
+/**
+ * @brief Barycentric data for extending the evaluations of a univariate over {0, ..., domain_size - 1} to {0, ...,
+ * num_evals - 1}, using O(domain_size + num_evals) memory
+ *
+ * @details BarycentricData precomputes an inverse 1/(d_j*(x_k - x_j)) for every pair of a domain point x_j and a new
+ * point x_k. For the long univariates that arise when folding many instances, that table is too large to build at
+ * compile time, or to keep around. As the points are consecutive integers, the inverse factors as weights[j] *
+ * inverses[k - j] with weights[j] = 1/d_j and inverses[i] = 1/i, which only take linear space. The data is computed
+ * at runtime, on first use.
+ */
+template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataFactored {
+  public:
+    static_assert(num_evals > domain_size);
+
+    // 1/d_j, where d_j = \prod_{i != j} (j - i) = (-1)^{domain_size - 1 - j} * j! * (domain_size - 1 - j)!
+    std::array<Fr, domain_size> weights;
+    // 1/i for i in {1, ..., num_evals - 1}; inverses[0] is unused
+    std::array<Fr, num_evals> inverses;
+    // full numerator M(x) = \prod_{i} (x - i) at each x in {0, ..., num_evals - 1}
+    std::array<Fr, num_evals> full_numerator_values;
+
+    static const BarycentricDataFactored& get()
+    {
+        static const BarycentricDataFactored data;
+        return data;
+    }
+
+  private:
+    BarycentricDataFactored()
+    {
+        std::array<Fr, domain_size> factorials;
+        factorials[0] = 1;
+        for (size_t i = 1; i != domain_size; ++i) {
+            factorials[i] = factorials[i - 1] * Fr(i);
+        }
+        for (size_t j = 0; j != domain_size; ++j) {
+            weights[j] = factorials[j] * factorials[domain_size - 1 - j];
+            if ((domain_size - 1 - j) % 2 == 1) {
+                weights[j] = -weights[j];
+            }
+        }
+        Fr::batch_invert(weights.data(), domain_size);
+
+        inverses[0] = 1;
+        for (size_t i = 1; i != num_evals; ++i) {
+            inverses[i] = Fr(i);
+        }
+        Fr::batch_invert(inverses.data(), num_evals);
+
+        // M(x) vanishes on the domain, and M(x + 1) = M(x) * (x + 1) / (x + 1 - domain_size) beyond it
+        for (size_t i = 0; i != domain_size; ++i) {
+            full_numerator_values[i] = 0;
+        }
+        full_numerator_values[domain_size] = factorials[domain_size - 1] * Fr(domain_size);
+        for (size_t i = domain_size; i + 1 != num_evals; ++i) {
+            full_numerator_values[i + 1] = full_numerator_values[i] * Fr(i + 1) * inverses[i + 1 - domain_size];
+        }
+    }
+};
+
+// Extensions that would need more precomputed denominator inverses than this use BarycentricDataFactored
+static constexpr size_t BARYCENTRIC_MAX_PRECOMPUTED_SIZE = 1 << 12;
+
 /**
  * @brief Helper to determine whether input is bberg::field type
  *
@@ -47,6 +47,42 @@ TYPED_TEST(BarycentricDataTests, Evaluate)
     EXPECT_EQ(result, expected_result);
 }
 
+/**
+ * @brief Check extension and evaluation of a univariate long enough that the extension uses BarycentricDataFactored
+ * rather than a precomputed table
+ */
+TYPED_TEST(BarycentricDataTests, ExtendAndEvaluateLongUnivariate)
+{
+    BARYCENTIC_DATA_TESTS_TYPE_ALIASES
+    const size_t domain_size(40);
+    const size_t num_evals(120);
+    static_assert(domain_size * num_evals > BARYCENTRIC_MAX_PRECOMPUTED_SIZE);
+
+    std::array<FF, domain_size> coefficients;
+    for (auto& coeff : coefficients) {
+        coeff = FF::random_element();
+    }
+    const auto evaluate_from_coefficients = [&](const FF& x) {
+        FF result = 0;
+        for (size_t i = domain_size; i != 0; --i) {
+            result = result * x + coefficients[i - 1];
+        }
+        return result;
+    };
+
+    Univariate<FF, domain_size> f;
+    for (size_t i = 0; i < domain_size; ++i) {
+        f.value_at(i) = evaluate_from_coefficients(FF(i));
+    }
+    auto result = f.template extend_to<num_evals>();
+    for (size_t i = 0; i < num_evals; ++i) {
+        EXPECT_EQ(result.value_at(i), evaluate_from_coefficients(FF(i)));
+    }
+
+    FF u = FF::random_element();
+    EXPECT_EQ(f.evaluate(u), evaluate_from_coefficients(u));
+}
+
 TYPED_TEST(BarycentricDataTests, BarycentricData2to3)
 {
     BARYCENTIC_DATA_TESTS_TYPE_ALIASES
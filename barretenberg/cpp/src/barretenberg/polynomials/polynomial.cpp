@@ -2,6 +2,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <cstddef>
@@ -12,6 +13,10 @@
 #include <sys/stat.h>
 #include <unordered_map>
 #include <utility>
+#ifndef __wasm__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace bb {
 
@@ -102,6 +107,49 @@ Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points, std::span<c
         evaluations.data(), coefficients_, interpolation_points.data(), size_);
 }
 
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::map_file(std::string const& path)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        throw_or_abort("Filename not found: " + path);
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+
+    Polynomial<Fr> result;
+    result.size_ = file_size / sizeof(Fr);
+#ifndef __wasm__
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Failed to open file: " + path);
+    }
+    // Reserve zeroed anonymous memory for the whole capacity first and map the file over the start of it, so that the
+    // shift padding past the end of the file is addressable and zero.
+    const size_t map_size = sizeof(Fr) * result.capacity();
+    void* memory = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory != MAP_FAILED && file_size > 0 &&
+        mmap(memory, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(memory, map_size);
+        memory = MAP_FAILED;
+    }
+    close(fd);
+    if (memory == MAP_FAILED) {
+        throw_or_abort("Failed to map file: " + path);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    result.backing_memory_ = std::shared_ptr<Fr[]>(static_cast<Fr*>(memory),
+                                                   [memory, map_size](Fr*) { munmap(memory, map_size); });
+    result.coefficients_ = result.backing_memory_.get();
+#else
+    result.allocate_backing_memory(result.size_);
+    std::ifstream file(path, std::ios::binary);
+    if (!file.read(reinterpret_cast<char*>(result.coefficients_), (std::streamsize)(result.size_ * sizeof(Fr)))) {
+        throw_or_abort("Failed to open file: " + path);
+    }
+    result.zero_memory_beyond(result.size_);
+#endif
+    return result;
+}
+
 // Assignments
 
 // full copy "expensive" assignment
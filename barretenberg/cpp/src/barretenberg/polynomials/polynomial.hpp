@@ -231,6 +231,14 @@ template <typename Fr> class Polynomial {
     std::size_t size() const { return size_; }
     std::size_t capacity() const { return size_ + MAXIMUM_COEFFICIENT_SHIFT; }
 
+    /**
+     * @brief Map a file holding the raw coefficients of a polynomial into memory
+     *
+     * @details The mapping is private, so writes to the polynomial never reach the file, and pages that are only read
+     * are shared with every other process mapping the same file. Platforms without mmap read the file instead.
+     */
+    static Polynomial map_file(std::string const& path);
+
     static Polynomial random(const size_t num_coeffs)
     {
         Polynomial p(num_coeffs);
@@ -5,6 +5,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -168,6 +169,137 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+// The FFT rounds that only combine elements within an aligned block of this many field elements (128KiB for 256-bit
+// fields) are run block by block, so that each block stays in L2 cache while all of them are applied to it
+constexpr size_t FFT_BLOCK_SIZE = 1UL << 12;
+
+/**
+ * @brief Run `func(start, end)` over `num_threads` even slices of [0, num_iterations)
+ * @details A single thread runs on the calling thread, so that the FFT can be used from inside a parallel_for
+ */
+template <typename Func> void fft_parallel_slices(const size_t num_iterations, const size_t num_threads, Func&& func)
+{
+    const size_t threads = std::max(std::min(num_threads, num_iterations), size_t{ 1 });
+    if (threads == 1) {
+        func(size_t{ 0 }, num_iterations);
+        return;
+    }
+    const size_t slice_size = (num_iterations + threads - 1) / threads;
+    parallel_for(threads, [&](size_t j) {
+        func(std::min(j * slice_size, num_iterations), std::min((j + 1) * slice_size, num_iterations));
+    });
+}
+
+/**
+ * @brief Run the butterfly rounds m = 2, 4, ..., end_m / 2 of a decimation-in-time FFT on `size` bit-reversed elements
+ * of `data`, whose first (m = 1) round has already been applied
+ *
+ * @details Rounds with 2m <= FFT_BLOCK_SIZE only combine elements of the same aligned block, so each thread takes whole
+ * blocks through all of them while they are in cache, with a single barrier for all of these rounds. The remaining
+ * rounds are fused in pairs into radix-4 passes: rounds m and 2m combine the four elements k + j + {0, m, 2m, 3m}
+ * among themselves, so one pass over the data and one barrier do the work of two rounds. Every round reads its roots
+ * from its own `root_table` entry, as in the radix-2 FFT.
+ */
+template <typename Fr>
+void fft_butterfly_rounds(
+    Fr* data, const size_t size, const size_t end_m, const std::vector<Fr*>& root_table, const size_t num_threads)
+{
+    const size_t block_size = std::min(size, FFT_BLOCK_SIZE);
+    const size_t blocked_end_m = std::min(end_m, block_size);
+    if (blocked_end_m > 2) {
+        fft_parallel_slices(size / block_size, num_threads, [&](size_t start, size_t end) {
+            Fr temp;
+            for (size_t block = start; block < end; ++block) {
+                Fr* block_data = data + block * block_size;
+                for (size_t m = 2; m < blocked_end_m; m <<= 1) {
+                    const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+                    for (size_t k = 0; k < block_size; k += 2 * m) {
+                        for (size_t j = 0; j < m; ++j) {
+                            temp = round_roots[j] * block_data[k + j + m];
+                            block_data[k + j + m] = block_data[k + j] - temp;
+                            block_data[k + j] += temp;
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    size_t m = std::max(blocked_end_m, size_t{ 2 });
+    while (m < end_m) {
+        const size_t block_mask = m - 1;
+        const size_t index_mask = ~block_mask;
+        const size_t log2_m = static_cast<size_t>(numeric::get_msb(m));
+        const Fr* round_roots = root_table[log2_m - 1];
+        if (2 * m < end_m) {
+            const Fr* next_round_roots = root_table[log2_m];
+            fft_parallel_slices(size >> 2, num_threads, [&](size_t start, size_t end) {
+                Fr temp;
+                Fr x0;
+                Fr x1;
+                Fr x2;
+                Fr x3;
+                for (size_t i = start; i < end; ++i) {
+                    const size_t j = i & block_mask;
+                    Fr* x = data + ((i & index_mask) << 2) + j;
+                    // round m: (x[0], x[m]) and (x[2m], x[3m])
+                    temp = round_roots[j] * x[m];
+                    x1 = x[0] - temp;
+                    x0 = x[0] + temp;
+                    temp = round_roots[j] * x[3 * m];
+                    x3 = x[2 * m] - temp;
+                    x2 = x[2 * m] + temp;
+                    // round 2m: (x[0], x[2m]) and (x[m], x[3m])
+                    temp = next_round_roots[j] * x2;
+                    x[2 * m] = x0 - temp;
+                    x[0] = x0 + temp;
+                    temp = next_round_roots[j + m] * x3;
+                    x[3 * m] = x1 - temp;
+                    x[m] = x1 + temp;
+                }
+            });
+            m <<= 2;
+        } else {
+            fft_parallel_slices(size >> 1, num_threads, [&](size_t start, size_t end) {
+                Fr temp;
+                for (size_t i = start; i < end; ++i) {
+                    const size_t k1 = (i & index_mask) << 1;
+                    const size_t j1 = i & block_mask;
+                    temp = round_roots[j1] * data[k1 + j1 + m];
+                    data[k1 + j1 + m] = data[k1 + j1] - temp;
+                    data[k1 + j1] += temp;
+                }
+            });
+            m <<= 1;
+        }
+    }
+}
+
+/**
+ * @brief An in-place FFT of a single polynomial on the calling thread, for transforming many polynomials at once
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_in_place(Fr* coeffs, const EvaluationDomain<Fr>& domain, const std::vector<Fr*>& root_table)
+{
+    if (domain.size < 2) {
+        return;
+    }
+    for (size_t i = 0; i < domain.size; ++i) {
+        const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(domain.log2_size));
+        if (i < swap_index) {
+            Fr::__swap(coeffs[i], coeffs[swap_index]);
+        }
+    }
+    Fr temp;
+    for (size_t k = 0; k < domain.size; k += 2) {
+        Fr::__copy(coeffs[k + 1], temp);
+        coeffs[k + 1] = coeffs[k] - coeffs[k + 1];
+        coeffs[k] += temp;
+    }
+    fft_butterfly_rounds(coeffs, domain.size, domain.size, root_table, 1);
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -209,91 +341,43 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
         }
     });
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // hard code exception for when the domain size is tiny - there is no further round, so need to manually
     // reduce + copy
     if (domain.size <= 2) {
         coeffs[0][0] = scratch_space[0];
         coeffs[0][1] = scratch_space[1];
+        return;
     }
 
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
+    // All but the last round run on `scratch_space`, see fft_butterfly_rounds
+    fft_butterfly_rounds(scratch_space, domain.size, domain.size >> 1, root_table, domain.num_threads);
 
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
-                }
-            } else {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-
-                    size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                    size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                    size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                    size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                    coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                }
-            }
-        });
-    }
+    // The last round is treated differently from the others, so that we can reduce out of our 'coarse' reduction and
+    // store the output in `coeffs` instead of `scratch_space`.
+    // The loop is flattened: for each iteration `i`, the root we need is `round_roots[i & (m - 1)]` and the even
+    // element of the butterfly is at `((i & ~(m - 1)) << 1) + (i & (m - 1))`. As this is the last round, m = n / 2.
+    const size_t m = domain.size >> 1;
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+    parallel_for(domain.num_threads, [&](size_t j) {
+        Fr temp;
+        const size_t start = j * (domain.thread_size >> 1);
+        const size_t end = (j + 1) * (domain.thread_size >> 1);
+        for (size_t i = start; i < end; ++i) {
+            size_t k1 = (i & index_mask) << 1;
+            size_t j1 = i & block_mask;
+
+            size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
+            size_t elem_idx_1 = (k1 + j1) & poly_mask;
+            size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
+            size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
+
+            temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+            coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
+            coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
+        }
+    });
 }
 
 template <typename Fr>
@@ -327,68 +411,7 @@ void fft_inner_parallel(
         coeffs[1] = target[1];
     }
 
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
-            }
-        });
-    }
+    fft_butterfly_rounds(target, domain.size, domain.size, root_table, domain.num_threads);
 }
 
 template <typename Fr>
@@ -737,6 +760,61 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     }
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    // With fewer polynomials than threads, transforming them one at a time on all threads keeps every thread busy
+    if (polynomials.size() < get_num_cpus()) {
+        for (Fr* coeffs : polynomials) {
+            fft(coeffs, domain);
+        }
+        return;
+    }
+    parallel_for(polynomials.size(),
+                 [&](size_t i) { fft_inner_in_place(polynomials[i], domain, domain.get_round_roots()); });
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    if (polynomials.size() < get_num_cpus()) {
+        for (Fr* coeffs : polynomials) {
+            ifft(coeffs, domain);
+        }
+        return;
+    }
+    parallel_for(polynomials.size(), [&](size_t i) {
+        Fr* coeffs = polynomials[i];
+        fft_inner_in_place(coeffs, domain, domain.get_inverse_round_roots());
+        for (size_t j = 0; j < domain.size; ++j) {
+            coeffs[j] *= domain.domain_inverse;
+        }
+    });
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    if (polynomials.size() < get_num_cpus()) {
+        for (Fr* coeffs : polynomials) {
+            coset_fft(coeffs, domain);
+        }
+        return;
+    }
+    parallel_for(polynomials.size(), [&](size_t i) {
+        Fr* coeffs = polynomials[i];
+        Fr work_generator = Fr::one();
+        for (size_t j = 0; j < domain.generator_size; ++j) {
+            coeffs[j] *= work_generator;
+            work_generator *= domain.generator;
+        }
+        fft_inner_in_place(coeffs, domain, domain.get_round_roots());
+    });
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -872,7 +950,7 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     });
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
-    Fr::batch_invert(l_1_coefficients, target_domain.size);
+    Fr::parallel_batch_invert(std::span{ l_1_coefficients, target_domain.size });
 
     // Step 2: Compute numerator (1/n)*(X_i^n - 1)
     // First compute X_i^n (which forms a multiplicative subgroup of order k)
@@ -1146,7 +1224,7 @@ Fr compute_barycentric_evaluation(const Fr* coeffs,
         work_root *= domain.root_inverse;
     }
 
-    Fr::batch_invert(denominators, num_coeffs);
+    Fr::parallel_batch_invert(std::span{ denominators, num_coeffs });
 
     Fr result = Fr::zero();
 
@@ -1385,6 +1463,9 @@ template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void ifft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
+template void fft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
@@ -1,5 +1,6 @@
 #pragma once
 #include "evaluation_domain.hpp"
+#include <span>
 
 namespace bb::polynomial_arithmetic {
 
@@ -95,6 +96,21 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+/**
+ * @brief In-place transforms of many polynomials of size domain.size at once
+ * @details With at least as many polynomials as threads, each thread transforms whole polynomials in place, which
+ * avoids the barriers between FFT rounds and the scratch space of the single-polynomial transforms
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
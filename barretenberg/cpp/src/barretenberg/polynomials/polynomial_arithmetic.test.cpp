@@ -1,10 +1,12 @@
 #include "polynomial_arithmetic.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "polynomial.hpp"
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <utility>
@@ -156,6 +158,91 @@ TEST(polynomials, fft_ifft_consistency)
     }
 }
 
+/**
+ * @brief The blocked and radix-4 rounds of the parallel FFT agree with the serial radix-2 FFT, for sizes that end on a
+ * radix-4 and on a radix-2 pass after the blocked rounds
+ */
+TEST(polynomials, blocked_fft_matches_serial_fft)
+{
+    for (size_t log_n : std::array<size_t, 5>{ 5, 12, 13, 14, 15 }) {
+        const size_t n = 1UL << log_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<fr> input(n);
+        for (auto& coeff : input) {
+            coeff = fr::random_element();
+        }
+        std::vector<fr> expected = input;
+        polynomial_arithmetic::fft_inner_serial<fr>({ expected.data() }, n, domain.get_round_roots());
+
+        std::vector<fr> in_place = input;
+        polynomial_arithmetic::fft(in_place.data(), domain);
+        std::vector<fr> source = input;
+        std::vector<fr> target(n);
+        polynomial_arithmetic::fft(source.data(), target.data(), domain);
+        std::vector<fr> split = input;
+        const size_t quarter = n / 4;
+        polynomial_arithmetic::fft<fr>(
+            { &split[0], &split[quarter], &split[2 * quarter], &split[3 * quarter] }, domain);
+
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(in_place[i], expected[i]);
+            EXPECT_EQ(target[i], expected[i]);
+            EXPECT_EQ(split[i], expected[i]);
+        }
+    }
+}
+
+TEST(polynomials, fft_batch)
+{
+    constexpr size_t n = 1 << 13;
+    // Enough polynomials for the batch to be split across threads by polynomial
+    const size_t num_polys = 2 * get_num_cpus();
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> batch(num_polys, std::vector<fr>(n));
+    for (auto& poly : batch) {
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+    }
+    const auto input = batch;
+    std::vector<fr*> coeffs;
+    for (auto& poly : batch) {
+        coeffs.emplace_back(poly.data());
+    }
+
+    auto reset = [&]() {
+        for (size_t j = 0; j < num_polys; ++j) {
+            std::copy(input[j].begin(), input[j].end(), batch[j].begin());
+        }
+    };
+    auto expect_transform = [&](auto transform) {
+        for (size_t j = 0; j < num_polys; ++j) {
+            std::vector<fr> expected = input[j];
+            transform(expected.data());
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(batch[j][i], expected[i]);
+            }
+        }
+    };
+
+    polynomial_arithmetic::fft_batch<fr>(coeffs, domain);
+    expect_transform([&](fr* poly) { polynomial_arithmetic::fft(poly, domain); });
+
+    reset();
+    polynomial_arithmetic::coset_fft_batch<fr>(coeffs, domain);
+    expect_transform([&](fr* poly) { polynomial_arithmetic::coset_fft(poly, domain); });
+
+    // The inverse undoes the batched forward transform
+    reset();
+    polynomial_arithmetic::fft_batch<fr>(coeffs, domain);
+    polynomial_arithmetic::ifft_batch<fr>(coeffs, domain);
+    expect_transform([](fr*) {});
+}
+
 TEST(polynomials, split_polynomial_fft_ifft_consistency)
 {
     constexpr size_t n = 256;
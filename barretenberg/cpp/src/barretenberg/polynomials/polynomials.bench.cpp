@@ -238,6 +238,31 @@ void fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+constexpr size_t NUM_BATCHED_POLYS = 8;
+void fft_bench_one_by_one(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        for (size_t i = 0; i < NUM_BATCHED_POLYS; ++i) {
+            bb::polynomial_arithmetic::fft(globals.data + i * (size_t)state.range(0), evaluation_domains[idx]);
+        }
+    }
+}
+BENCHMARK(fft_bench_one_by_one)->RangeMultiplier(4)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
+void fft_bench_batch(State& state) noexcept
+{
+    std::vector<fr*> polys;
+    for (size_t i = 0; i < NUM_BATCHED_POLYS; ++i) {
+        polys.emplace_back(globals.data + i * (size_t)state.range(0));
+    }
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        bb::polynomial_arithmetic::fft_batch<fr>(polys, evaluation_domains[idx]);
+    }
+}
+BENCHMARK(fft_bench_batch)->RangeMultiplier(4)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
 void fft_bench_serial(State& state) noexcept
 {
     for (auto _ : state) {
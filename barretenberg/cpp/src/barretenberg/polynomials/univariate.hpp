@@ -95,6 +95,16 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
 
     static Univariate random_element() { return get_random(); };
 
+    bool is_zero() const
+    {
+        for (const auto& eval : evaluations) {
+            if (!eval.is_zero()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Operations between Univariate and other Univariate
     bool operator==(const Univariate& other) const = default;
 
@@ -288,6 +298,23 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
                 result.value_at(idx + 1) = result.value_at(idx) + delta;
             }
             return result;
+        } else if constexpr (LENGTH * EXTENDED_LENGTH > BARYCENTRIC_MAX_PRECOMPUTED_SIZE) {
+            static_assert(domain_start == 0);
+            const auto& data = BarycentricDataFactored<Fr, LENGTH, EXTENDED_LENGTH>::get();
+            std::array<Fr, LENGTH> weighted_evaluations;
+            for (size_t j = 0; j != LENGTH; ++j) {
+                weighted_evaluations[j] = evaluations[j] * data.weights[j];
+            }
+            for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
+                // compute each term v_j / (d_j*(x-x_j)) of the sum
+                Fr sum = 0;
+                for (size_t j = 0; j != LENGTH; ++j) {
+                    sum += weighted_evaluations[j] * data.inverses[k - j];
+                }
+                // scale the sum by the the value of of B(x)
+                result.value_at(k) = sum * data.full_numerator_values[k];
+            }
+            return result;
         } else {
             for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
                 result.value_at(k) = 0;
@@ -312,21 +339,38 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
      */
     Fr evaluate(const Fr& u)
     {
-        using Data = BarycentricData<Fr, domain_end, LENGTH, domain_start>;
         Fr full_numerator_value = 1;
         for (size_t i = domain_start; i != domain_end; ++i) {
             full_numerator_value *= u - i;
         }
 
+        // The domain is made of consecutive integers, so the lagrange denominators d_i = \prod_{j != i} (x_i - x_j) are
+        // (-1)^{LENGTH - 1 - i} * i! * (LENGTH - 1 - i)!. Computing them from factorials rather than from
+        // BarycentricData avoids building its LENGTH * LENGTH table for long univariates.
+        std::array<Fr, LENGTH> factorials;
+        factorials[0] = 1;
+        for (size_t i = 1; i != LENGTH; ++i) {
+            factorials[i] = factorials[i - 1] * Fr(i);
+        }
+
         // build set of domain size-many denominator inverses 1/(d_i*(x_k - x_j)). will multiply against each of
         // these (rather than to divide by something) for each barycentric evaluation
         std::array<Fr, LENGTH> denominator_inverses;
         for (size_t i = 0; i != LENGTH; ++i) {
-            Fr inv = Data::lagrange_denominators[i];
-            inv *= u - Data::big_domain[i]; // warning: need to avoid zero here
-            inv = Fr(1) / inv;
+            Fr inv = factorials[i] * factorials[LENGTH - 1 - i];
+            if ((LENGTH - 1 - i) % 2 == 1) {
+                inv = -inv;
+            }
+            inv *= u - (i + domain_start); // warning: need to avoid zero here
             denominator_inverses[i] = inv;
         }
+        if constexpr (is_field_type_v<Fr>) {
+            Fr::batch_invert(denominator_inverses);
+        } else {
+            for (auto& inv : denominator_inverses) {
+                inv = Fr(1) / inv;
+            }
+        }
 
         Fr result = 0;
         // compute each term v_j / (d_j*(x-x_j)) of the sum
@@ -55,6 +55,7 @@ template <typename FF_> class StandardArith {
     const SelectorType& q_c() const { return selectors[4]; };
 
     auto& get() { return selectors; };
+    const auto& get() const { return selectors; };
 
     void reserve(size_t size_hint)
     {
@@ -103,6 +104,7 @@ template <typename FF_> class UltraArith {
     const SelectorType& q_lookup_type() const { return selectors[10]; };
 
     auto& get() { return selectors; };
+    const auto& get() const { return selectors; };
 
     void reserve(size_t size_hint)
     {
@@ -165,6 +167,7 @@ template <typename FF_> class UltraHonkArith {
     const SelectorType& q_poseidon2_internal() const { return this->selectors[13]; };
 
     auto& get() { return selectors; };
+    const auto& get() const { return selectors; };
 
     void reserve(size_t size_hint)
     {
@@ -4,10 +4,12 @@
 #pragma once
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/proof_system/circuit_builder/circuit_builder_base.hpp"
+#include "barretenberg/proof_system/circuit_builder/trace_checker.hpp"
 #include "barretenberg/relations/generic_lookup/generic_lookup_relation.hpp"
 #include "barretenberg/relations/generic_permutation/generic_permutation_relation.hpp"
 
@@ -122,17 +124,27 @@ class AvmCircuitBuilder {
     static constexpr size_t num_fixed_columns = 87;
     static constexpr size_t num_polys = 73;
     std::vector<Row> rows;
+    // Set instead of rows by the trace builders that write the trace directly into columns
+    ProverPolynomials columns;
 
     void set_trace(std::vector<Row>&& trace) { rows = std::move(trace); }
+    void set_trace(ProverPolynomials&& trace) { columns = std::move(trace); }
 
     ProverPolynomials compute_polynomials()
     {
         const auto num_rows = get_circuit_subgroup_size();
         ProverPolynomials polys;
 
-        // Allocate mem for each column
-        for (auto& poly : polys.get_all()) {
-            poly = Polynomial(num_rows);
+        if (columns.get_polynomial_size() > 0) {
+            // The columns only have to be copied, one per thread, instead of being transposed from the rows
+            auto unshifted = polys.get_unshifted();
+            auto unshifted_columns = columns.get_unshifted();
+            parallel_for(unshifted.size(), [&](size_t i) { unshifted[i] = unshifted_columns[i]; });
+        } else {
+            // Allocate mem for each column
+            for (auto& poly : polys.get_all()) {
+                poly = Polynomial(num_rows);
+            }
         }
 
         for (size_t i = 0; i < rows.size(); i++) {
@@ -229,7 +241,10 @@ class AvmCircuitBuilder {
         return polys;
     }
 
-    [[maybe_unused]] bool check_circuit()
+    /**
+     * @brief Check that the trace satisfies all relations, see TraceCheckMode for the available checks
+     */
+    [[maybe_unused]] bool check_circuit(TraceCheckMode mode = TraceCheckMode::EXHAUSTIVE)
     {
 
         const FF gamma = FF::random_element();
@@ -248,75 +263,56 @@ class AvmCircuitBuilder {
         auto polys = compute_polynomials();
         const size_t num_rows = polys.get_polynomial_size();
 
-        const auto evaluate_relation = [&]<typename Relation>(const std::string& relation_name,
-                                                              std::string (*debug_label)(int)) {
-            typename Relation::SumcheckArrayOfValuesOverSubrelations result;
-            for (auto& r : result) {
-                r = 0;
-            }
-            constexpr size_t NUM_SUBRELATIONS = result.size();
-
-            for (size_t i = 0; i < num_rows; ++i) {
-                Relation::accumulate(result, polys.get_row(i), {}, 1);
+        bb::compute_logderivative_inverse<Flavor, equiv_tag_err_relation<FF>>(polys, params, num_rows);
 
-                bool x = true;
-                for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
-                    if (result[j] != 0) {
-                        std::string row_name = debug_label(static_cast<int>(j));
-                        throw_or_abort(
-                            format("Relation ", relation_name, ", subrelation index ", row_name, " failed at row ", i));
-                        x = false;
-                    }
-                }
-                if (!x) {
-                    return false;
-                }
+        if (mode == TraceCheckMode::BATCHED) {
+            const auto sums = trace_checker::accumulate_batched<Avm_vm::avm_mem<FF>,
+                                                                Avm_vm::avm_alu<FF>,
+                                                                Avm_vm::avm_main<FF>,
+                                                                equiv_tag_err_relation<FF>>(
+                polys, params, num_rows, FF::random_element());
+            if (!trace_checker::check_batched_relation(
+                    std::get<0>(sums), "avm_mem", Avm_vm::get_relation_label_avm_mem)) {
+                return false;
             }
-            return true;
-        };
-
-        const auto evaluate_logderivative = [&]<typename LogDerivativeSettings>(const std::string& lookup_name) {
-            // Check the logderivative relation
-            bb::compute_logderivative_inverse<Flavor, LogDerivativeSettings>(polys, params, num_rows);
-
-            typename LogDerivativeSettings::SumcheckArrayOfValuesOverSubrelations lookup_result;
-
-            for (auto& r : lookup_result) {
-                r = 0;
+            if (!trace_checker::check_batched_relation(
+                    std::get<1>(sums), "avm_alu", Avm_vm::get_relation_label_avm_alu)) {
+                return false;
             }
-            for (size_t i = 0; i < num_rows; ++i) {
-                LogDerivativeSettings::accumulate(lookup_result, polys.get_row(i), params, 1);
+            if (!trace_checker::check_batched_relation(
+                    std::get<2>(sums), "avm_main", Avm_vm::get_relation_label_avm_main)) {
+                return false;
             }
-            for (auto r : lookup_result) {
-                if (r != 0) {
-                    info("Lookup ", lookup_name, " failed.");
-                    return false;
-                }
+            if (!trace_checker::check_batched_logderivative(std::get<3>(sums), "equiv_tag_err")) {
+                return false;
             }
             return true;
-        };
+        }
 
-        if (!evaluate_relation.template operator()<Avm_vm::avm_mem<FF>>("avm_mem",
-                                                                        Avm_vm::get_relation_label_avm_mem)) {
+        if (!trace_checker::check_relation<Avm_vm::avm_mem<FF>>(
+                polys, num_rows, "avm_mem", Avm_vm::get_relation_label_avm_mem)) {
             return false;
         }
-        if (!evaluate_relation.template operator()<Avm_vm::avm_alu<FF>>("avm_alu",
-                                                                        Avm_vm::get_relation_label_avm_alu)) {
+        if (!trace_checker::check_relation<Avm_vm::avm_alu<FF>>(
+                polys, num_rows, "avm_alu", Avm_vm::get_relation_label_avm_alu)) {
             return false;
         }
-        if (!evaluate_relation.template operator()<Avm_vm::avm_main<FF>>("avm_main",
-                                                                         Avm_vm::get_relation_label_avm_main)) {
+        if (!trace_checker::check_relation<Avm_vm::avm_main<FF>>(
+                polys, num_rows, "avm_main", Avm_vm::get_relation_label_avm_main)) {
             return false;
         }
 
-        if (!evaluate_logderivative.template operator()<equiv_tag_err_relation<FF>>("equiv_tag_err")) {
+        if (!trace_checker::check_logderivative<equiv_tag_err_relation<FF>>(polys, params, num_rows, "equiv_tag_err")) {
             return false;
         }
 
         return true;
     }
 
-    [[nodiscard]] size_t get_num_gates() const { return rows.size(); }
+    [[nodiscard]] size_t get_num_gates() const
+    {
+        return columns.get_polynomial_size() > 0 ? columns.get_polynomial_size() : rows.size();
+    }
 
     [[nodiscard]] size_t get_circuit_subgroup_size() const
     {
@@ -8,6 +8,7 @@
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/proof_system/circuit_builder/circuit_builder_base.hpp"
+#include "barretenberg/proof_system/circuit_builder/trace_checker.hpp"
 #include "barretenberg/relations/generic_lookup/generic_lookup_relation.hpp"
 #include "barretenberg/relations/generic_permutation/generic_permutation_relation.hpp"
 
@@ -111,7 +112,10 @@ class ToyCircuitBuilder {
         return polys;
     }
 
-    [[maybe_unused]] bool check_circuit()
+    /**
+     * @brief Check that the trace satisfies all relations, see TraceCheckMode for the available checks
+     */
+    [[maybe_unused]] bool check_circuit(TraceCheckMode mode = TraceCheckMode::EXHAUSTIVE)
     {
 
         const FF gamma = FF::random_element();
@@ -130,70 +134,54 @@ class ToyCircuitBuilder {
         auto polys = compute_polynomials();
         const size_t num_rows = polys.get_polynomial_size();
 
-        const auto evaluate_relation = [&]<typename Relation>(const std::string& relation_name,
-                                                              std::string (*debug_label)(int)) {
-            typename Relation::SumcheckArrayOfValuesOverSubrelations result;
-            for (auto& r : result) {
-                r = 0;
+        bb::compute_logderivative_inverse<Flavor, two_column_perm_relation<FF>>(polys, params, num_rows);
+        bb::compute_logderivative_inverse<Flavor, two_column_sparse_perm_relation<FF>>(polys, params, num_rows);
+        bb::compute_logderivative_inverse<Flavor, lookup_xor_relation<FF>>(polys, params, num_rows);
+        bb::compute_logderivative_inverse<Flavor, lookup_err_relation<FF>>(polys, params, num_rows);
+
+        if (mode == TraceCheckMode::BATCHED) {
+            const auto sums = trace_checker::accumulate_batched<Toy_vm::toy_avm<FF>,
+                                                                two_column_perm_relation<FF>,
+                                                                two_column_sparse_perm_relation<FF>,
+                                                                lookup_xor_relation<FF>,
+                                                                lookup_err_relation<FF>>(
+                polys, params, num_rows, FF::random_element());
+            if (!trace_checker::check_batched_relation(
+                    std::get<0>(sums), "toy_avm", Toy_vm::get_relation_label_toy_avm)) {
+                return false;
             }
-            constexpr size_t NUM_SUBRELATIONS = result.size();
-
-            for (size_t i = 0; i < num_rows; ++i) {
-                Relation::accumulate(result, polys.get_row(i), {}, 1);
-
-                bool x = true;
-                for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
-                    if (result[j] != 0) {
-                        std::string row_name = debug_label(static_cast<int>(j));
-                        throw_or_abort(
-                            format("Relation ", relation_name, ", subrelation index ", row_name, " failed at row ", i));
-                        x = false;
-                    }
-                }
-                if (!x) {
-                    return false;
-                }
+            if (!trace_checker::check_batched_logderivative(std::get<1>(sums), "two_column_perm")) {
+                return false;
             }
-            return true;
-        };
-
-        const auto evaluate_logderivative = [&]<typename LogDerivativeSettings>(const std::string& lookup_name) {
-            // Check the logderivative relation
-            bb::compute_logderivative_inverse<Flavor, LogDerivativeSettings>(polys, params, num_rows);
-
-            typename LogDerivativeSettings::SumcheckArrayOfValuesOverSubrelations lookup_result;
-
-            for (auto& r : lookup_result) {
-                r = 0;
+            if (!trace_checker::check_batched_logderivative(std::get<2>(sums), "two_column_sparse_perm")) {
+                return false;
             }
-            for (size_t i = 0; i < num_rows; ++i) {
-                LogDerivativeSettings::accumulate(lookup_result, polys.get_row(i), params, 1);
+            if (!trace_checker::check_batched_logderivative(std::get<3>(sums), "lookup_xor")) {
+                return false;
             }
-            for (auto r : lookup_result) {
-                if (r != 0) {
-                    info("Lookup ", lookup_name, " failed.");
-                    return false;
-                }
+            if (!trace_checker::check_batched_logderivative(std::get<4>(sums), "lookup_err")) {
+                return false;
             }
             return true;
-        };
+        }
 
-        if (!evaluate_relation.template operator()<Toy_vm::toy_avm<FF>>("toy_avm",
-                                                                        Toy_vm::get_relation_label_toy_avm)) {
+        if (!trace_checker::check_relation<Toy_vm::toy_avm<FF>>(
+                polys, num_rows, "toy_avm", Toy_vm::get_relation_label_toy_avm)) {
             return false;
         }
 
-        if (!evaluate_logderivative.template operator()<two_column_perm_relation<FF>>("two_column_perm")) {
+        if (!trace_checker::check_logderivative<two_column_perm_relation<FF>>(
+                polys, params, num_rows, "two_column_perm")) {
             return false;
         }
-        if (!evaluate_logderivative.template operator()<two_column_sparse_perm_relation<FF>>(
-                "two_column_sparse_perm")) {
+        if (!trace_checker::check_logderivative<two_column_sparse_perm_relation<FF>>(
+                polys, params, num_rows, "two_column_sparse_perm")) {
             return false;
         }
-        if (!evaluate_logderivative.template operator()<lookup_xor_relation<FF>>("lookup_xor")) {
+        if (!trace_checker::check_logderivative<lookup_xor_relation<FF>>(polys, params, num_rows, "lookup_xor")) {
             return false;
         }
-        if (!evaluate_logderivative.template operator()<lookup_err_relation<FF>>("lookup_err")) {
+        if (!trace_checker::check_logderivative<lookup_err_relation<FF>>(polys, params, num_rows, "lookup_err")) {
             return false;
         }
 
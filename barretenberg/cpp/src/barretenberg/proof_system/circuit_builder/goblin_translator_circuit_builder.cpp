@@ -8,6 +8,7 @@
  *
  */
 #include "goblin_translator_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
@@ -372,7 +373,7 @@ GoblinTranslatorCircuitBuilder::AccumulationInput generate_witness_values(Fr op_
  *
  * @param acc_step
  */
-void GoblinTranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput acc_step)
+void GoblinTranslatorCircuitBuilder::create_accumulation_gate(const AccumulationInput& acc_step)
 {
     // The first wires OpQueue/Transcript wires
     // Opcode should be {0,1,2,3,4,8}
@@ -602,9 +603,9 @@ GoblinTranslatorCircuitBuilder::AccumulationInput compute_witness_values_for_one
 void GoblinTranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<ECCOpQueue> ecc_op_queue)
 {
     using Fq = bb::fq;
-    std::vector<Fq> accumulator_trace;
-    Fq current_accumulator(0);
-    if (ecc_op_queue->raw_ops.empty()) {
+    const auto& raw_ops = ecc_op_queue->raw_ops;
+    const size_t num_ops = raw_ops.size();
+    if (num_ops == 0) {
         return;
     }
     // Rename for ease of use
@@ -612,31 +613,38 @@ void GoblinTranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_
     auto v = batching_challenge_v;
 
     // We need to precompute the accumulators at each step, because in the actual circuit we compute the values starting
-    // from the later indices. We need to know the previous accumulator to create the gate
-    for (size_t i = 0; i < ecc_op_queue->raw_ops.size(); i++) {
-        auto& ecc_op = ecc_op_queue->raw_ops[ecc_op_queue->raw_ops.size() - 1 - i];
+    // from the later indices. The gate of the i-th op starts from the accumulation of all the ops after it, which is the
+    // only value that makes the steps depend on each other
+    std::vector<Fq> previous_accumulators(num_ops);
+    Fq current_accumulator(0);
+    previous_accumulators[num_ops - 1] = current_accumulator;
+    for (size_t i = num_ops - 1; i > 0; i--) {
+        const auto& ecc_op = raw_ops[i];
         current_accumulator *= x;
         current_accumulator +=
             (Fq(ecc_op.get_opcode_value()) +
              v * (ecc_op.base_point.x + v * (ecc_op.base_point.y + v * (ecc_op.z1 + v * ecc_op.z2))));
-        accumulator_trace.push_back(current_accumulator);
+        previous_accumulators[i - 1] = current_accumulator;
     }
 
-    // We don't care about the last value since we'll recompute it during witness generation anyway
-    accumulator_trace.pop_back();
-
-    for (auto& raw_op : ecc_op_queue->raw_ops) {
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
+    // With the accumulators known, the limb decompositions and the non-native arithmetic of every step are independent,
+    // so they are computed in parallel. The gates are then appended in order, since adding variables is sequential. Ops
+    // are processed in chunks to bound the memory taken by the witness values waiting to be laid out
+    constexpr size_t MAX_OPS_PER_CHUNK = 1 << 10;
+    std::vector<AccumulationInput> accumulation_steps(std::min(num_ops, MAX_OPS_PER_CHUNK));
+    for (auto& wire : wires) {
+        wire.reserve(wire.size() + 2 * num_ops);
+    }
+    for (size_t chunk_start = 0; chunk_start < num_ops; chunk_start += MAX_OPS_PER_CHUNK) {
+        const size_t chunk_size = std::min(MAX_OPS_PER_CHUNK, num_ops - chunk_start);
+        parallel_for(chunk_size, [&](size_t i) {
+            const size_t op_idx = chunk_start + i;
+            accumulation_steps[i] =
+                compute_witness_values_for_one_ecc_op(raw_ops[op_idx], previous_accumulators[op_idx], v, x);
+        });
+        for (size_t i = 0; i < chunk_size; i++) {
+            create_accumulation_gate(accumulation_steps[i]);
         }
-        // Compute witness values
-        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_op, previous_accumulator, v, x);
-
-        // And put them into the wires
-        create_accumulation_gate(one_accumulation_step);
     }
 }
 bool GoblinTranslatorCircuitBuilder::check_circuit()
@@ -427,7 +427,7 @@ class GoblinTranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
      *
      * @param acc_step
      */
-    void create_accumulation_gate(AccumulationInput acc_step);
+    void create_accumulation_gate(const AccumulationInput& acc_step);
 
     /**
      * @brief Get the result of accumulation
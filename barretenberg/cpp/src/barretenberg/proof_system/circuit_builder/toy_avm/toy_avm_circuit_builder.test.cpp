@@ -211,4 +211,52 @@ TEST(ToyAVMCircuitBuilder, SparsePermutation)
     // Expect it to break after changing row5
     circuit_builder.rows[4].toy_sparse_column_2 = FF(421);
     EXPECT_EQ(circuit_builder.check_circuit(), false);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Check that the exhaustive check reports the first failing row of every failing subrelation, and that the
+ * batched check accepts and rejects the same traces
+ */
+TEST(ToyAVMCircuitBuilder, CheckModes)
+{
+    using FF = ToyFlavor::FF;
+    using Builder = ToyCircuitBuilder;
+    using Row = Builder::Row;
+    Builder circuit_builder;
+
+    // Enough rows to be split across several threads
+    const size_t circuit_size = 256;
+    std::vector<Row> rows(circuit_size);
+    for (size_t i = 0; i < circuit_size; i += 2) {
+        rows[i].toy_set_1_column_1 = FF(i);
+        rows[circuit_size - 1 - i].toy_set_2_column_1 = FF(i);
+        rows[i].toy_q_tuple_set = FF(1);
+        rows[circuit_size - 1 - i].toy_q_tuple_set = FF(1);
+    }
+    circuit_builder.set_trace(std::move(rows));
+    EXPECT_TRUE(circuit_builder.check_circuit(TraceCheckMode::EXHAUSTIVE));
+    EXPECT_TRUE(circuit_builder.check_circuit(TraceCheckMode::BATCHED));
+
+    // Make toy_q_xor non-boolean on two rows and toy_q_xor_table on one
+    circuit_builder.rows[200].toy_q_xor = FF(2);
+    circuit_builder.rows[37].toy_q_xor = FF(2);
+    circuit_builder.rows[150].toy_q_xor_table = FF(3);
+    try {
+        circuit_builder.check_circuit(TraceCheckMode::EXHAUSTIVE);
+        FAIL() << "An exception was expected";
+    } catch (const std::exception& e) {
+        const std::string message = e.what();
+        EXPECT_NE(message.find("subrelation index 1 failed at row 37"), std::string::npos);
+        EXPECT_NE(message.find("subrelation index 2 failed at row 150"), std::string::npos);
+        EXPECT_EQ(message.find("subrelation index 0"), std::string::npos);
+    }
+    EXPECT_ANY_THROW(circuit_builder.check_circuit(TraceCheckMode::BATCHED));
+
+    // Break the permutation instead
+    circuit_builder.rows[200].toy_q_xor = FF(0);
+    circuit_builder.rows[37].toy_q_xor = FF(0);
+    circuit_builder.rows[150].toy_q_xor_table = FF(0);
+    circuit_builder.rows[100].toy_set_1_column_1 = FF(1);
+    EXPECT_FALSE(circuit_builder.check_circuit(TraceCheckMode::EXHAUSTIVE));
+    EXPECT_FALSE(circuit_builder.check_circuit(TraceCheckMode::BATCHED));
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief How check_circuit of the generated VM circuit builders validates a trace
+ *
+ * @details EXHAUSTIVE evaluates every subrelation on every row and reports the first failing row of each failing
+ * subrelation. BATCHED makes a single pass over the trace that accumulates every relation, each row weighted by a
+ * power of a random challenge, and checks that the weighted sums vanish. A row on which some subrelation does not
+ * vanish makes the sum of that subrelation a nonzero polynomial in the challenge of degree smaller than the number of
+ * rows, so the check only misses it with probability at most num_rows / |F|. It does not locate the failing row, so it
+ * is meant for validating traces in production; EXHAUSTIVE is for debugging them.
+ */
+enum class TraceCheckMode { EXHAUSTIVE, BATCHED };
+
+namespace trace_checker {
+
+/**
+ * @brief Split the rows [0, num_rows) into contiguous ranges and run func(thread_idx, start, end) on each in parallel
+ * @return The number of ranges, i.e. of distinct thread indices func was called with
+ */
+template <typename Func> size_t for_each_row_range(size_t num_rows, const Func& func)
+{
+    // Not worth spawning threads for a handful of rows per thread
+    constexpr size_t MIN_ROWS_PER_THREAD = 16;
+    const size_t num_threads = std::max(size_t{ 1 }, std::min(get_num_cpus(), num_rows / MIN_ROWS_PER_THREAD));
+    const size_t rows_per_thread = num_rows / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * rows_per_thread;
+        const size_t end = (thread_idx == num_threads - 1) ? num_rows : start + rows_per_thread;
+        func(thread_idx, start, end);
+    });
+    return num_threads;
+}
+
+template <typename FF, size_t N> void add_to(std::array<FF, N>& accumulator, const std::array<FF, N>& other)
+{
+    for (size_t i = 0; i < N; ++i) {
+        accumulator[i] += other[i];
+    }
+}
+
+template <typename... Values> void add_to(std::tuple<Values...>& accumulator, const std::tuple<Values...>& other)
+{
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        (add_to(std::get<I>(accumulator), std::get<I>(other)), ...);
+    }(std::index_sequence_for<Values...>{});
+}
+
+/**
+ * @brief Evaluate every subrelation of Relation on every row and throw listing, for every subrelation that fails, the
+ * first row it fails on
+ */
+template <typename Relation, typename Polynomials>
+bool check_relation(const Polynomials& polys,
+                    size_t num_rows,
+                    const std::string& relation_name,
+                    std::string (*debug_label)(int))
+{
+    using Values = typename Relation::SumcheckArrayOfValuesOverSubrelations;
+    constexpr size_t NUM_SUBRELATIONS = std::tuple_size_v<Values>;
+
+    // The first failing row of every subrelation, per thread; num_rows if it holds on all rows of the thread
+    std::vector<std::array<size_t, NUM_SUBRELATIONS>> first_failures(get_num_cpus());
+    const size_t num_threads = for_each_row_range(num_rows, [&](size_t thread_idx, size_t start, size_t end) {
+        auto& failures = first_failures[thread_idx];
+        failures.fill(num_rows);
+        for (size_t i = start; i < end; ++i) {
+            Values result;
+            for (auto& r : result) {
+                r = 0;
+            }
+            Relation::accumulate(result, polys.get_row(i), {}, 1);
+            for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
+                if (result[j] != 0 && failures[j] == num_rows) {
+                    failures[j] = i;
+                }
+            }
+        }
+    });
+
+    std::string message;
+    for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
+        size_t first_failure = num_rows;
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            first_failure = std::min(first_failure, first_failures[thread_idx][j]);
+        }
+        if (first_failure != num_rows) {
+            message += format(message.empty() ? "" : "; ",
+                              "Relation ",
+                              relation_name,
+                              ", subrelation index ",
+                              debug_label(static_cast<int>(j)),
+                              " failed at row ",
+                              first_failure);
+        }
+    }
+    if (!message.empty()) {
+        throw_or_abort(message);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check a log-derivative lookup or permutation whose inverses have already been computed, by summing its
+ * subrelations over the trace in parallel
+ */
+template <typename LogDerivativeSettings, typename Polynomials, typename FF>
+bool check_logderivative(const Polynomials& polys,
+                         const RelationParameters<FF>& params,
+                         size_t num_rows,
+                         const std::string& lookup_name)
+{
+    using Values = typename LogDerivativeSettings::SumcheckArrayOfValuesOverSubrelations;
+
+    std::vector<Values> thread_results(get_num_cpus());
+    const size_t num_threads = for_each_row_range(num_rows, [&](size_t thread_idx, size_t start, size_t end) {
+        auto& result = thread_results[thread_idx];
+        for (auto& r : result) {
+            r = 0;
+        }
+        for (size_t i = start; i < end; ++i) {
+            LogDerivativeSettings::accumulate(result, polys.get_row(i), params, 1);
+        }
+    });
+    for (size_t thread_idx = 1; thread_idx < num_threads; ++thread_idx) {
+        add_to(thread_results[0], thread_results[thread_idx]);
+    }
+    for (auto r : thread_results[0]) {
+        if (r != 0) {
+            info("Lookup ", lookup_name, " failed.");
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Accumulate all Relations over the trace in one parallel pass, row i scaled by challenge^i
+ * @details Linearly dependent subrelations (those of the log-derivative lookups) ignore the scaling factor, so they are
+ * summed as they are. The inverses of any log-derivative relation must already have been computed.
+ * @return The weighted sums of the subrelations of every relation, in the order of Relations
+ */
+template <typename... Relations, typename Polynomials, typename FF>
+std::tuple<typename Relations::SumcheckArrayOfValuesOverSubrelations...> accumulate_batched(
+    const Polynomials& polys, const RelationParameters<FF>& params, size_t num_rows, const FF& challenge)
+{
+    using Sums = std::tuple<typename Relations::SumcheckArrayOfValuesOverSubrelations...>;
+    const auto zero = [](Sums& sums) {
+        std::apply([](auto&... values) { ((values.fill(0)), ...); }, sums);
+    };
+
+    std::vector<Sums> thread_sums(get_num_cpus());
+    const size_t num_threads = for_each_row_range(num_rows, [&](size_t thread_idx, size_t start, size_t end) {
+        auto& sums = thread_sums[thread_idx];
+        zero(sums);
+        FF weight = challenge.pow(start);
+        for (size_t i = start; i < end; ++i) {
+            // Extract the row once for all relations
+            const auto row = polys.get_row(i);
+            std::apply([&](auto&... values) { ((Relations::accumulate(values, row, params, weight)), ...); }, sums);
+            weight *= challenge;
+        }
+    });
+    for (size_t thread_idx = 1; thread_idx < num_threads; ++thread_idx) {
+        add_to(thread_sums[0], thread_sums[thread_idx]);
+    }
+    return thread_sums[0];
+}
+
+/**
+ * @brief Throw if a relation's batched sums computed by accumulate_batched do not all vanish
+ */
+template <typename Values>
+bool check_batched_relation(const Values& sums, const std::string& relation_name, std::string (*debug_label)(int))
+{
+    for (size_t j = 0; j < sums.size(); ++j) {
+        if (sums[j] != 0) {
+            throw_or_abort(format("Relation ",
+                                  relation_name,
+                                  ", subrelation index ",
+                                  debug_label(static_cast<int>(j)),
+                                  " failed on some row (batched check)"));
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Report whether a log-derivative relation's sums computed by accumulate_batched all vanish
+ */
+template <typename Values> bool check_batched_logderivative(const Values& sums, const std::string& lookup_name)
+{
+    for (auto r : sums) {
+        if (r != 0) {
+            info("Lookup ", lookup_name, " failed.");
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace trace_checker
+} // namespace bb
@@ -617,14 +617,14 @@ uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF&
 template <typename Arithmetization>
 plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
-        if (table.id == id) {
-            return table;
-        }
-    }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
-    return lookup_tables[lookup_tables.size() - 1];
+    size_t& position = lookup_table_positions[id];
+    if (position == 0) {
+        // Table isn't used yet! So copy it from the shared, lazily generated tables.
+        plookup::BasicTable& table = lookup_tables.emplace_back(plookup::get_basic_table(id));
+        table.table_index = lookup_tables.size() - 1;
+        position = lookup_tables.size();
+    }
+    return lookup_tables[position - 1];
 }
 
 /**
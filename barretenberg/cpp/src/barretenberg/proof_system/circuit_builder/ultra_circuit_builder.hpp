@@ -616,6 +616,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     std::map<FF, uint32_t> constant_variable_indices;
 
     std::vector<plookup::BasicTable> lookup_tables;
+    // Position of each basic table in lookup_tables plus one, or zero if the circuit does not use the table (yet)
+    std::array<size_t, plookup::BasicTableId::NUM_BASIC_TABLES> lookup_table_positions{};
     std::vector<plookup::MultiTable> lookup_multi_tables;
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -710,6 +712,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         constant_variable_indices = other.constant_variable_indices;
 
         lookup_tables = other.lookup_tables;
+        lookup_table_positions = other.lookup_table_positions;
         lookup_multi_tables = other.lookup_multi_tables;
         range_lists = other.range_lists;
         ram_arrays = other.ram_arrays;
@@ -728,6 +731,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         constant_variable_indices = other.constant_variable_indices;
 
         lookup_tables = other.lookup_tables;
+        lookup_table_positions = other.lookup_table_positions;
         lookup_multi_tables = other.lookup_multi_tables;
         range_lists = other.range_lists;
         ram_arrays = other.ram_arrays;
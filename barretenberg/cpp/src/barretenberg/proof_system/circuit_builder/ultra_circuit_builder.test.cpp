@@ -103,6 +103,95 @@ TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
     EXPECT_TRUE(saved_state.is_same_state(circuit_builder));
 }
 
+TEST(ultra_circuit_constructor, lookup_tables_are_shared_across_builders)
+{
+    // Both builders copy their tables from the same lazily generated prototype but index them independently.
+    const auto& prototype = plookup::get_basic_table(plookup::BasicTableId::UINT_XOR_ROTATE0);
+    EXPECT_EQ(&prototype, &plookup::get_basic_table(plookup::BasicTableId::UINT_XOR_ROTATE0));
+
+    for (size_t i = 0; i < 2; ++i) {
+        UltraCircuitBuilder circuit_builder = UltraCircuitBuilder();
+        const fr left = engine.get_random_uint32();
+        const fr right = engine.get_random_uint32();
+        const auto left_index = circuit_builder.add_variable(left);
+        const auto right_index = circuit_builder.add_variable(right);
+
+        const auto sequence_data = plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, left, right, true);
+        circuit_builder.create_gates_from_plookup_accumulators(
+            MultiTableId::UINT32_XOR, sequence_data, left_index, right_index);
+
+        const auto& table = circuit_builder.get_table(plookup::BasicTableId::UINT_XOR_ROTATE0);
+        EXPECT_EQ(&table, &circuit_builder.get_table(plookup::BasicTableId::UINT_XOR_ROTATE0));
+        EXPECT_EQ(table.table_index, 0UL);
+        EXPECT_EQ(circuit_builder.lookup_tables.size(), 1UL);
+        EXPECT_EQ(table.column_1, prototype.column_1);
+        EXPECT_EQ(table.column_3, prototype.column_3);
+        EXPECT_TRUE(circuit_builder.check_circuit());
+    }
+}
+
+TEST(ultra_circuit_constructor, basic_tables_blob_round_trip)
+{
+    const std::array ids{ plookup::BasicTableId::UINT_XOR_ROTATE0, plookup::BasicTableId::AES_SBOX_MAP };
+    const auto blob = plookup::serialize_basic_tables(ids);
+
+    EXPECT_TRUE(plookup::load_basic_tables(blob));
+    EXPECT_EQ(plookup::serialize_basic_tables(ids), blob);
+
+    auto truncated = blob;
+    truncated.resize(blob.size() - 1);
+    EXPECT_FALSE(plookup::load_basic_tables(truncated));
+
+    auto bad_magic = blob;
+    bad_magic[0] ^= 1;
+    EXPECT_FALSE(plookup::load_basic_tables(bad_magic));
+}
+
+TEST(ultra_circuit_constructor, basic_tables_blob_round_trip_every_table)
+{
+    // Not every id has a table that can be created
+    std::vector<plookup::BasicTableId> ids;
+    for (size_t i = 0; i < plookup::BasicTableId::NUM_BASIC_TABLES; ++i) {
+        const auto id = static_cast<plookup::BasicTableId>(i);
+        try {
+            plookup::get_basic_table(id);
+            ids.push_back(id);
+        } catch (...) {
+        }
+    }
+    EXPECT_GT(ids.size(), plookup::BasicTableId::FIXED_BASE_3_0 - plookup::BasicTableId::FIXED_BASE_0_0);
+
+    const auto blob = plookup::serialize_basic_tables(ids);
+    EXPECT_TRUE(plookup::load_basic_tables(blob));
+    EXPECT_EQ(plookup::serialize_basic_tables(ids), blob);
+
+    // A blob may hold every id once, so pad it with empty tables for the ids that cannot be created
+    auto every_id = blob;
+    auto write_u64 = [&every_id](uint64_t value) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        every_id.insert(every_id.end(), bytes, bytes + sizeof(value));
+    };
+    for (size_t i = 0; i < plookup::BasicTableId::NUM_BASIC_TABLES; ++i) {
+        if (std::find(ids.begin(), ids.end(), static_cast<plookup::BasicTableId>(i)) == ids.end()) {
+            write_u64(i);
+            write_u64(/*size=*/0);
+            write_u64(/*use_twin_keys=*/0);
+            every_id.resize(every_id.size() + 3 * sizeof(fr));
+        }
+    }
+    uint64_t num_tables = plookup::BasicTableId::NUM_BASIC_TABLES;
+    std::memcpy(every_id.data() + sizeof(uint64_t), &num_tables, sizeof(num_tables));
+    EXPECT_TRUE(plookup::load_basic_tables(every_id));
+
+    // But no more tables than there are ids
+    num_tables++;
+    std::memcpy(every_id.data() + sizeof(uint64_t), &num_tables, sizeof(num_tables));
+    EXPECT_FALSE(plookup::load_basic_tables(every_id));
+
+    const std::array duplicate_ids{ ids[0], ids[1], ids[0] };
+    EXPECT_FALSE(plookup::load_basic_tables(plookup::serialize_basic_tables(duplicate_ids)));
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -9,6 +9,8 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -19,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,7 +32,7 @@ namespace bb {
 
 /**
  * @brief cycle_node represents the index of a value of the circuit.
- * It will belong to a CyclicPermutation, such that all nodes in a CyclicPermutation
+ * It will belong to a copy cycle, such that all nodes in a copy cycle
  * must have the value.
  * The total number of constraints is always <2^32 since that is the type used to represent variables, so we can save
  * space by using a type smaller than size_t.
@@ -63,24 +66,47 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
      */
     PermutationMapping(size_t circuit_size)
     {
-        for (uint8_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
-            sigmas[col_idx].reserve(circuit_size);
-            if constexpr (generalized) {
-                ids[col_idx].reserve(circuit_size);
+        for (auto& sigma : sigmas) {
+            sigma.resize(circuit_size);
+        }
+        if constexpr (generalized) {
+            for (auto& id : ids) {
+                id.resize(circuit_size);
             }
-            // Initialize every element to point to itself
-            for (uint32_t row_idx = 0; row_idx < circuit_size; ++row_idx) {
-                permutation_subgroup_element self{ row_idx, col_idx };
-                sigmas[col_idx].emplace_back(self);
-                if constexpr (generalized) {
-                    ids[col_idx].emplace_back(self);
+        }
+        // Initialize every element to point to itself
+        run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+            for (uint8_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
+                for (size_t row_idx = start; row_idx < end; ++row_idx) {
+                    permutation_subgroup_element self{ static_cast<uint32_t>(row_idx), col_idx };
+                    sigmas[col_idx][row_idx] = self;
+                    if constexpr (generalized) {
+                        ids[col_idx][row_idx] = self;
+                    }
                 }
             }
-        }
+        });
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, stored flat rather than as one vector per cycle
+ *
+ * @details Every real variable of the circuit has a cycle, made of the wire addresses holding the variable in the order
+ * in which they appear in the execution trace. The nodes of the cycle of real variable i are
+ * nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1]. Building the cycles takes two passes over the trace, one to count
+ * the nodes of every cycle and one to place them, and no allocation per cycle.
+ */
+struct CopyCycles {
+    std::vector<size_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    [[nodiscard]] size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    [[nodiscard]] std::span<const cycle_node> operator[](size_t cycle_index) const
+    {
+        return { nodes.data() + offsets[cycle_index], offsets[cycle_index + 1] - offsets[cycle_index] };
+    }
+};
 
 namespace {
 /**
@@ -99,7 +125,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    std::vector<CyclicPermutation> wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -108,44 +134,57 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            cycle_node current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
+    // Tags are small consecutive integers, so the tag permutation tau is looked up in a dense table rather than the map
+    std::vector<uint32_t> tau;
+    if constexpr (generalized) {
+        if (!circuit_constructor.tau.empty()) {
+            tau.resize(static_cast<size_t>(circuit_constructor.tau.rbegin()->first) + 1);
+            for (const auto& [tag, tau_tag] : circuit_constructor.tau) {
+                tau[tag] = tau_tag;
+            }
+        }
+    }
+
+    // Go through each cycle. Every wire address belongs to exactly one cycle, so cycles can be processed in parallel.
+    run_loop_in_parallel(wire_copy_cycles.size(), [&](size_t start, size_t end) {
+        for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+            const auto copy_cycle = wire_copy_cycles[cycle_index];
+            for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                cycle_node current_cycle_node = copy_cycle[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
+                const auto current_row = current_cycle_node.gate_index;
+                const auto next_row = next_cycle_node.gate_index;
+
+                const auto current_column = current_cycle_node.wire_index;
+                const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = {
+                    .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                };
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                if constexpr (generalized) {
+                    bool first_node = (node_idx == 0);
+                    bool last_node = (next_cycle_node_index == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column][current_row].is_tag = true;
+                        mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                    }
+                    if (last_node) {
+                        const uint32_t tag = real_variable_tags[cycle_index];
+                        if (tag >= tau.size()) {
+                            throw_or_abort("compute_permutation_mapping: variable has a tag that is not in tau");
+                        }
+                        mapping.sigmas[current_column][current_row].is_tag = true;
+                        mapping.sigmas[current_column][current_row].row_index = tau[tag];
+                    }
                 }
             }
         }
-        cycle_index++;
-    }
+    });
 
     // Add information about public inputs to the computation
     const auto num_public_inputs = static_cast<uint32_t>(circuit_constructor.public_inputs.size());
@@ -190,14 +229,15 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
     using FF = typename Flavor::FF;
     const size_t num_gates = proving_key->circuit_size;
 
+    // Fill all columns in the same pass over the rows
+    ITERATE_OVER_DOMAIN_START(proving_key->evaluation_domain);
     size_t wire_index = 0;
     for (auto& current_permutation_poly : permutation_polynomials) {
-        ITERATE_OVER_DOMAIN_START(proving_key->evaluation_domain);
         const auto& current_mapping = permutation_mappings[wire_index][i];
         if (current_mapping.is_public_input) {
             // We intentionally want to break the cycles of the public input variables.
             // During the witness generation, the left and right wire polynomials at index i contain the i-th public
-            // input. The CyclicPermutation created for these variables always start with (i) -> (n+i), followed by
+            // input. The copy cycle created for these variables always start with (i) -> (n+i), followed by
             // the indices of the variables in the "real" gates. We make i point to -(i+1), so that the only way of
             // repairing the cycle is add the mapping
             //  -(i+1) -> (n+i)
@@ -212,9 +252,9 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
             // index
             current_permutation_poly[i] = FF(current_mapping.row_index + num_gates * current_mapping.column_index);
         }
-        ITERATE_OVER_DOMAIN_END;
         wire_index++;
     }
+    ITERATE_OVER_DOMAIN_END;
 }
 } // namespace
 
@@ -375,7 +415,7 @@ template <typename Flavor> inline void compute_first_and_last_lagrange_polynomia
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              std::vector<CyclicPermutation> copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkFlavor<Flavor> || IsUltraFlavor<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
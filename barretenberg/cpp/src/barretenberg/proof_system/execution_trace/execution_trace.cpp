@@ -19,21 +19,40 @@ void ExecutionTrace_<Flavor>::generate(const Builder& builder,
 }
 
 template <class Flavor>
-void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(
-    TraceData& trace_data, const Builder& builder, const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+void ExecutionTrace_<Flavor>::generate_wires(const Builder& builder,
+                                             const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+{
+    auto trace_data = construct_trace_data(builder, proving_key->circuit_size);
+
+    add_wires_to_proving_key(trace_data, proving_key);
+}
+
+template <class Flavor>
+void ExecutionTrace_<Flavor>::add_wires_to_proving_key(TraceData& trace_data,
+                                                       const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
 {
     if constexpr (IsHonkFlavor<Flavor>) {
         for (auto [pkey_wire, trace_wire] : zip_view(proving_key->get_wires(), trace_data.wires)) {
             pkey_wire = std::move(trace_wire);
         }
-        for (auto [pkey_selector, trace_selector] : zip_view(proving_key->get_selectors(), trace_data.selectors)) {
-            pkey_selector = std::move(trace_selector);
-        }
     } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
             std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
             proving_key->polynomial_store.put(wire_tag, std::move(trace_data.wires[idx]));
         }
+    }
+}
+
+template <class Flavor>
+void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(
+    TraceData& trace_data, const Builder& builder, const std::shared_ptr<typename Flavor::ProvingKey>& proving_key)
+{
+    add_wires_to_proving_key(trace_data, proving_key);
+    if constexpr (IsHonkFlavor<Flavor>) {
+        for (auto [pkey_selector, trace_selector] : zip_view(proving_key->get_selectors(), trace_data.selectors)) {
+            pkey_selector = std::move(trace_selector);
+        }
+    } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.selectors.size(); ++idx) {
             proving_key->polynomial_store.put(builder.selector_names[idx] + "_lagrange",
                                               std::move(trace_data.selectors[idx]));
@@ -52,27 +71,37 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
     // appropriate block. In the mean time we do some inefficient copying etc to construct it here post facto.
     auto trace_blocks = create_execution_trace_blocks(builder);
 
+    // Call func(real_var_idx, node) for every wire address that is copy constrained, in trace order
+    const auto for_each_copy_constrained_wire = [&](const auto& func) {
+        uint32_t offset = 0;
+        for (auto& block : trace_blocks) {
+            auto block_size = static_cast<uint32_t>(block.wires[0].size());
+            // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
+            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
+                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                    // NB: Not adding cycles for wires 3 and 4 here is only needed in order to maintain consistency with
+                    // old version. We can remove this special case and the result is simply that all the zeros in
+                    // wires 3 and 4 over the PI range are copy constrained together, but this changes sigma/id which
+                    // changes the vkey.
+                    if (!(block.is_public_input && wire_idx > 1)) {
+                        uint32_t var_idx = block.wires[wire_idx][block_row_idx];
+                        func(builder.real_variable_index[var_idx], cycle_node{ wire_idx, block_row_idx + offset });
+                    }
+                }
+            }
+            offset += block_size;
+        }
+    };
+
     uint32_t offset = 0; // Track offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    // For each block in the trace, populate wire polys and selector polys
     for (auto& block : trace_blocks) {
         auto block_size = static_cast<uint32_t>(block.wires[0].size());
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-            for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                uint32_t trace_row_idx = block_row_idx + offset;
-                // Insert the real witness values from this block into the wire polys at the correct offset
-                trace_data.wires[wire_idx][trace_row_idx] = builder.get_variable(var_idx);
-                // Add the address of the witness value to its corresponding copy cycle
-                // NB: Not adding cycles for wires 3 and 4 here is only needed in order to maintain consistency with old
-                // version. We can remove this special case and the result is simply that all the zeros in wires 3 and 4
-                // over the PI range are copy constrained together, but this changes sigma/id which changes the vkey.
-                if (!(block.is_public_input && wire_idx > 1)) {
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
+        // Insert the real witness values from this block into the wire polys at the correct offset
+        for (auto [wire_poly, wire] : zip_view(trace_data.wires, block.wires)) {
+            for (uint32_t row_idx = 0; row_idx < block_size; ++row_idx) {
+                wire_poly[row_idx + offset] = builder.get_variable(wire[row_idx]);
             }
         }
 
@@ -87,6 +116,17 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
 
         offset += block_size;
     }
+
+    // Build the copy cycles in two passes: count the nodes of every cycle, then place each node in its cycle
+    auto& copy_cycles = trace_data.copy_cycles;
+    for_each_copy_constrained_wire([&](uint32_t real_var_idx, cycle_node) { copy_cycles.offsets[real_var_idx + 1]++; });
+    for (size_t i = 1; i < copy_cycles.offsets.size(); ++i) {
+        copy_cycles.offsets[i] += copy_cycles.offsets[i - 1];
+    }
+    copy_cycles.nodes.resize(copy_cycles.offsets.back());
+    std::vector<size_t> next_node = copy_cycles.offsets;
+    for_each_copy_constrained_wire(
+        [&](uint32_t real_var_idx, cycle_node node) { copy_cycles.nodes[next_node[real_var_idx]++] = node; });
     return trace_data;
 }
 
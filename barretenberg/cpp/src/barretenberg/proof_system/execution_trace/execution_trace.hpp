@@ -33,8 +33,8 @@ template <class Flavor> class ExecutionTrace_ {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, Builder::Selectors::NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // For every real variable, the addresses into the wire polynomials whose values are copy constrained
+        CopyCycles copy_cycles;
 
         TraceData(size_t dyadic_circuit_size, const Builder& builder)
         {
@@ -45,7 +45,7 @@ template <class Flavor> class ExecutionTrace_ {
             for (auto& selector : selectors) {
                 selector = Polynomial(dyadic_circuit_size);
             }
-            copy_cycles.resize(builder.variables.size());
+            copy_cycles.offsets.resize(builder.variables.size() + 1);
         }
     };
 
@@ -56,7 +56,24 @@ template <class Flavor> class ExecutionTrace_ {
      */
     static void generate(const Builder& builder, const std::shared_ptr<ProvingKey>&);
 
+    /**
+     * @brief Given a circuit, populate a proving key that already holds the selector and sigma/id polys of a circuit
+     * with the same structure with the wire polys only
+     *
+     * @param builder
+     */
+    static void generate_wires(const Builder& builder, const std::shared_ptr<ProvingKey>&);
+
   private:
+    /**
+     * @brief Add the wire polynomials from the trace data to a honk or plonk proving key
+     *
+     * @param trace_data
+     * @param proving_key
+     */
+    static void add_wires_to_proving_key(TraceData& trace_data,
+                                         const std::shared_ptr<typename Flavor::ProvingKey>& proving_key);
+
     /**
      * @brief Add the wire and selector polynomials from the trace data to a honk or plonk proving key
      *
@@ -65,15 +65,28 @@ void compute_grand_product(const size_t circuit_size,
     // Populate `numerator` and `denominator` with the algebra described by Relation
     const size_t num_threads = circuit_size >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1;
     const size_t block_size = circuit_size / num_threads;
-    auto full_polynomials_view = full_polynomials.get_all();
+    // Only gather the entities the numerator and denominator read, rather than every entity of the flavor
+    auto polynomial_entities = GrandProdRelation::get_grand_product_entities(full_polynomials);
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
         const size_t end = (thread_idx + 1) * block_size;
         typename Flavor::AllValues evaluations;
-        auto evaluations_view = evaluations.get_all();
+        auto evaluation_entities = GrandProdRelation::get_grand_product_entities(evaluations);
+        // Polynomials may be shorter than the circuit, in which case they are zero beyond their size. Only check the
+        // sizes row by row if this happens within the rows of this thread.
+        bool entities_cover_block = true;
+        for (auto& poly : polynomial_entities) {
+            entities_cover_block &= poly.size() >= end;
+        }
         for (size_t i = start; i < end; ++i) {
-            for (auto [eval, full_poly] : zip_view(evaluations_view, full_polynomials_view)) {
-                eval = full_poly.size() > i ? full_poly[i] : 0;
+            if (entities_cover_block) {
+                for (auto [eval, full_poly] : zip_view(evaluation_entities, polynomial_entities)) {
+                    eval = full_poly[i];
+                }
+            } else {
+                for (auto [eval, full_poly] : zip_view(evaluation_entities, polynomial_entities)) {
+                    eval = full_poly.size() > i ? full_poly[i] : 0;
+                }
             }
             numerator[i] = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
                 evaluations, relation_parameters);
@@ -1,113 +1,195 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include <array>
+#include <cstring>
+#include <mutex>
 
 namespace bb::plookup {
 
 using namespace bb;
 
 namespace {
-// TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool inited = false;
+std::array<std::once_flag, MultiTableId::NUM_MULTI_TABLES> multi_table_init_flags;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<BasicTable, BasicTableId::NUM_BASIC_TABLES> BASIC_TABLES;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::once_flag, BasicTableId::NUM_BASIC_TABLES> basic_table_init_flags;
 
-void init_multi_tables()
+MultiTable generate_multi_table(const MultiTableId id)
 {
-    MULTI_TABLES[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_INPUT] =
-        sha256_tables::get_majority_input_table(MultiTableId::SHA256_MAJ_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_INPUT] =
-        sha256_tables::get_witness_extension_input_table(MultiTableId::SHA256_WITNESS_INPUT);
-    MULTI_TABLES[MultiTableId::SHA256_CH_OUTPUT] =
-        sha256_tables::get_choose_output_table(MultiTableId::SHA256_CH_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_MAJ_OUTPUT] =
-        sha256_tables::get_majority_output_table(MultiTableId::SHA256_MAJ_OUTPUT);
-    MULTI_TABLES[MultiTableId::SHA256_WITNESS_OUTPUT] =
-        sha256_tables::get_witness_extension_output_table(MultiTableId::SHA256_WITNESS_OUTPUT);
-    MULTI_TABLES[MultiTableId::AES_NORMALIZE] = aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
-    MULTI_TABLES[MultiTableId::AES_INPUT] = aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
-    MULTI_TABLES[MultiTableId::AES_SBOX] = aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
-    MULTI_TABLES[MultiTableId::UINT32_XOR] = uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
-    MULTI_TABLES[MultiTableId::UINT32_AND] = uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
-    MULTI_TABLES[MultiTableId::BN254_XLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
-        MultiTableId::BN254_XLO, BasicTableId::BN254_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
-        MultiTableId::BN254_XHI, BasicTableId::BN254_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YLO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
-        MultiTableId::BN254_YLO, BasicTableId::BN254_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_YHI] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
-        MultiTableId::BN254_YHI, BasicTableId::BN254_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
-        MultiTableId::BN254_XYPRIME, BasicTableId::BN254_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XLO_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
-        MultiTableId::BN254_XLO_ENDO, BasicTableId::BN254_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XHI_ENDO] = ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
-        MultiTableId::BN254_XHI_ENDO, BasicTableId::BN254_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BN254_XYPRIME_ENDO] =
-        ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_endo_table(
+    if (id >= KECCAK_NORMALIZE_AND_ROTATE && id < KECCAK_NORMALIZE_AND_ROTATE + 25) {
+        MultiTable table;
+        bb::constexpr_for<0, 25, 1>([&]<size_t i>() {
+            if (static_cast<size_t>(id) == static_cast<size_t>(KECCAK_NORMALIZE_AND_ROTATE) + i) {
+                table = keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
+            }
+        });
+        return table;
+    }
+    switch (id) {
+    case SHA256_CH_INPUT: {
+        return sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
+    }
+    case SHA256_MAJ_INPUT: {
+        return sha256_tables::get_majority_input_table(MultiTableId::SHA256_MAJ_INPUT);
+    }
+    case SHA256_WITNESS_INPUT: {
+        return sha256_tables::get_witness_extension_input_table(MultiTableId::SHA256_WITNESS_INPUT);
+    }
+    case SHA256_CH_OUTPUT: {
+        return sha256_tables::get_choose_output_table(MultiTableId::SHA256_CH_OUTPUT);
+    }
+    case SHA256_MAJ_OUTPUT: {
+        return sha256_tables::get_majority_output_table(MultiTableId::SHA256_MAJ_OUTPUT);
+    }
+    case SHA256_WITNESS_OUTPUT: {
+        return sha256_tables::get_witness_extension_output_table(MultiTableId::SHA256_WITNESS_OUTPUT);
+    }
+    case AES_NORMALIZE: {
+        return aes128_tables::get_aes_normalization_table(MultiTableId::AES_NORMALIZE);
+    }
+    case AES_INPUT: {
+        return aes128_tables::get_aes_input_table(MultiTableId::AES_INPUT);
+    }
+    case AES_SBOX: {
+        return aes128_tables::get_aes_sbox_table(MultiTableId::AES_SBOX);
+    }
+    case UINT32_XOR: {
+        return uint_tables::get_uint32_xor_table(MultiTableId::UINT32_XOR);
+    }
+    case UINT32_AND: {
+        return uint_tables::get_uint32_and_table(MultiTableId::UINT32_AND);
+    }
+    case BN254_XLO: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_table(
+            MultiTableId::BN254_XLO, BasicTableId::BN254_XLO_BASIC);
+    }
+    case BN254_XHI: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_table(
+            MultiTableId::BN254_XHI, BasicTableId::BN254_XHI_BASIC);
+    }
+    case BN254_YLO: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_ylo_table(
+            MultiTableId::BN254_YLO, BasicTableId::BN254_YLO_BASIC);
+    }
+    case BN254_YHI: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_yhi_table(
+            MultiTableId::BN254_YHI, BasicTableId::BN254_YHI_BASIC);
+    }
+    case BN254_XYPRIME: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_table(
+            MultiTableId::BN254_XYPRIME, BasicTableId::BN254_XYPRIME_BASIC);
+    }
+    case BN254_XLO_ENDO: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_xlo_endo_table(
+            MultiTableId::BN254_XLO_ENDO, BasicTableId::BN254_XLO_ENDO_BASIC);
+    }
+    case BN254_XHI_ENDO: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_xhi_endo_table(
+            MultiTableId::BN254_XHI_ENDO, BasicTableId::BN254_XHI_ENDO_BASIC);
+    }
+    case BN254_XYPRIME_ENDO: {
+        return ecc_generator_tables::ecc_generator_table<bb::g1>::get_xyprime_endo_table(
             MultiTableId::BN254_XYPRIME_ENDO, BasicTableId::BN254_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
-        MultiTableId::SECP256K1_XLO, BasicTableId::SECP256K1_XLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
-        MultiTableId::SECP256K1_XHI, BasicTableId::SECP256K1_XHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YLO] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
-        MultiTableId::SECP256K1_YLO, BasicTableId::SECP256K1_YLO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_YHI] = ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
-        MultiTableId::SECP256K1_YHI, BasicTableId::SECP256K1_YHI_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_table(
+    }
+    case SECP256K1_XLO: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_table(
+            MultiTableId::SECP256K1_XLO, BasicTableId::SECP256K1_XLO_BASIC);
+    }
+    case SECP256K1_XHI: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_table(
+            MultiTableId::SECP256K1_XHI, BasicTableId::SECP256K1_XHI_BASIC);
+    }
+    case SECP256K1_YLO: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_ylo_table(
+            MultiTableId::SECP256K1_YLO, BasicTableId::SECP256K1_YLO_BASIC);
+    }
+    case SECP256K1_YHI: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_yhi_table(
+            MultiTableId::SECP256K1_YHI, BasicTableId::SECP256K1_YHI_BASIC);
+    }
+    case SECP256K1_XYPRIME: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_table(
             MultiTableId::SECP256K1_XYPRIME, BasicTableId::SECP256K1_XYPRIME_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XLO_ENDO] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_endo_table(
+    }
+    case SECP256K1_XLO_ENDO: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xlo_endo_table(
             MultiTableId::SECP256K1_XLO_ENDO, BasicTableId::SECP256K1_XLO_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XHI_ENDO] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_endo_table(
+    }
+    case SECP256K1_XHI_ENDO: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xhi_endo_table(
             MultiTableId::SECP256K1_XHI_ENDO, BasicTableId::SECP256K1_XHI_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::SECP256K1_XYPRIME_ENDO] =
-        ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_endo_table(
+    }
+    case SECP256K1_XYPRIME_ENDO: {
+        return ecc_generator_tables::ecc_generator_table<secp256k1::g1>::get_xyprime_endo_table(
             MultiTableId::SECP256K1_XYPRIME_ENDO, BasicTableId::SECP256K1_XYPRIME_ENDO_BASIC);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR] = blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_16] =
-        blake2s_tables::get_blake2s_xor_rotate_16_table(MultiTableId::BLAKE_XOR_ROTATE_16);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_8] =
-        blake2s_tables::get_blake2s_xor_rotate_8_table(MultiTableId::BLAKE_XOR_ROTATE_8);
-    MULTI_TABLES[MultiTableId::BLAKE_XOR_ROTATE_7] =
-        blake2s_tables::get_blake2s_xor_rotate_7_table(MultiTableId::BLAKE_XOR_ROTATE_7);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_INPUT] =
-        keccak_tables::KeccakInput::get_keccak_input_table(MultiTableId::KECCAK_FORMAT_INPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_THETA_OUTPUT] =
-        keccak_tables::Theta::get_theta_output_table(MultiTableId::KECCAK_THETA_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_CHI_OUTPUT] =
-        keccak_tables::Chi::get_chi_output_table(MultiTableId::KECCAK_CHI_OUTPUT);
-    MULTI_TABLES[MultiTableId::KECCAK_FORMAT_OUTPUT] =
-        keccak_tables::KeccakOutput::get_keccak_output_table(MultiTableId::KECCAK_FORMAT_OUTPUT);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_LO] =
-        fixed_base::table::get_fixed_base_table<0, 128>(MultiTableId::FIXED_BASE_LEFT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_LEFT_HI] =
-        fixed_base::table::get_fixed_base_table<1, 126>(MultiTableId::FIXED_BASE_LEFT_HI);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_LO] =
-        fixed_base::table::get_fixed_base_table<2, 128>(MultiTableId::FIXED_BASE_RIGHT_LO);
-    MULTI_TABLES[MultiTableId::FIXED_BASE_RIGHT_HI] =
-        fixed_base::table::get_fixed_base_table<3, 126>(MultiTableId::FIXED_BASE_RIGHT_HI);
-
-    bb::constexpr_for<0, 25, 1>([&]<size_t i>() {
-        MULTI_TABLES[static_cast<size_t>(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE) + i] =
-            keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
-    });
-    MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
+    }
+    case BLAKE_XOR: {
+        return blake2s_tables::get_blake2s_xor_table(MultiTableId::BLAKE_XOR);
+    }
+    case BLAKE_XOR_ROTATE_16: {
+        return blake2s_tables::get_blake2s_xor_rotate_16_table(MultiTableId::BLAKE_XOR_ROTATE_16);
+    }
+    case BLAKE_XOR_ROTATE_8: {
+        return blake2s_tables::get_blake2s_xor_rotate_8_table(MultiTableId::BLAKE_XOR_ROTATE_8);
+    }
+    case BLAKE_XOR_ROTATE_7: {
+        return blake2s_tables::get_blake2s_xor_rotate_7_table(MultiTableId::BLAKE_XOR_ROTATE_7);
+    }
+    case KECCAK_FORMAT_INPUT: {
+        return keccak_tables::KeccakInput::get_keccak_input_table(MultiTableId::KECCAK_FORMAT_INPUT);
+    }
+    case KECCAK_THETA_OUTPUT: {
+        return keccak_tables::Theta::get_theta_output_table(MultiTableId::KECCAK_THETA_OUTPUT);
+    }
+    case KECCAK_CHI_OUTPUT: {
+        return keccak_tables::Chi::get_chi_output_table(MultiTableId::KECCAK_CHI_OUTPUT);
+    }
+    case KECCAK_FORMAT_OUTPUT: {
+        return keccak_tables::KeccakOutput::get_keccak_output_table(MultiTableId::KECCAK_FORMAT_OUTPUT);
+    }
+    case FIXED_BASE_LEFT_LO: {
+        return fixed_base::table::get_fixed_base_table<0, 128>(MultiTableId::FIXED_BASE_LEFT_LO);
+    }
+    case FIXED_BASE_LEFT_HI: {
+        return fixed_base::table::get_fixed_base_table<1, 126>(MultiTableId::FIXED_BASE_LEFT_HI);
+    }
+    case FIXED_BASE_RIGHT_LO: {
+        return fixed_base::table::get_fixed_base_table<2, 128>(MultiTableId::FIXED_BASE_RIGHT_LO);
+    }
+    case FIXED_BASE_RIGHT_HI: {
+        return fixed_base::table::get_fixed_base_table<3, 126>(MultiTableId::FIXED_BASE_RIGHT_HI);
+    }
+    case HONK_DUMMY_MULTI: {
+        return dummy_tables::get_honk_dummy_multitable();
+    }
+    default: {
+        throw_or_abort("multi table id does not exist");
+    }
+    }
 }
 } // namespace
 
+/**
+ * @brief Get the multi-table with the given id, generating it on first use
+ * @details Each multi-table is generated once per process, independently of the others, and is never modified
+ * afterwards, so the returned reference may be shared freely across builders and threads.
+ */
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!inited) {
-        init_multi_tables();
-        inited = true;
-    }
+    std::call_once(multi_table_init_flags[id], [id] { MULTI_TABLES[id] = generate_multi_table(id); });
     return MULTI_TABLES[id];
 }
 
+const BasicTable& get_basic_table(const BasicTableId id)
+{
+    std::call_once(basic_table_init_flags[id], [id] { BASIC_TABLES[id] = create_basic_table(id, 0); });
+    return BASIC_TABLES[id];
+}
+
 ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
                                          const fr& key_a,
                                          const fr& key_b,
@@ -201,4 +283,114 @@ ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
     return lookup;
 }
 
+namespace {
+// "BPLKTB01"
+constexpr uint64_t BASIC_TABLES_MAGIC = 0x3130424b544c5042;
+
+void write_u64(std::vector<uint8_t>& buf, const uint64_t value)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buf.insert(buf.end(), bytes, bytes + sizeof(value));
+}
+
+void write_frs(std::vector<uint8_t>& buf, const bb::fr* values, const size_t num_values)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(values);
+    buf.insert(buf.end(), bytes, bytes + num_values * sizeof(bb::fr));
+}
+
+/**
+ * @brief Bounds-checked reader over a basic table blob
+ */
+struct BlobReader {
+    std::span<const uint8_t> blob;
+    size_t offset = 0;
+
+    bool read(void* dest, const size_t num_bytes)
+    {
+        if (num_bytes > blob.size() - offset) {
+            return false;
+        }
+        std::memcpy(dest, blob.data() + offset, num_bytes);
+        offset += num_bytes;
+        return true;
+    }
+
+    bool read_frs(std::vector<bb::fr>& values, const size_t num_values)
+    {
+        if (num_values > (blob.size() - offset) / sizeof(bb::fr)) {
+            return false;
+        }
+        values.resize(num_values);
+        return read(values.data(), num_values * sizeof(bb::fr));
+    }
+};
+} // namespace
+
+std::vector<uint8_t> serialize_basic_tables(std::span<const BasicTableId> ids)
+{
+    std::vector<uint8_t> buf;
+    write_u64(buf, BASIC_TABLES_MAGIC);
+    write_u64(buf, ids.size());
+    for (const auto id : ids) {
+        const BasicTable& table = get_basic_table(id);
+        write_u64(buf, static_cast<uint64_t>(id));
+        write_u64(buf, table.size);
+        write_u64(buf, static_cast<uint64_t>(table.use_twin_keys));
+        write_frs(buf, &table.column_1_step_size, 1);
+        write_frs(buf, &table.column_2_step_size, 1);
+        write_frs(buf, &table.column_3_step_size, 1);
+        write_frs(buf, table.column_1.data(), table.size);
+        write_frs(buf, table.column_2.data(), table.size);
+        write_frs(buf, table.column_3.data(), table.size);
+    }
+    return buf;
+}
+
+bool load_basic_tables(std::span<const uint8_t> blob)
+{
+    BlobReader reader{ .blob = blob, .offset = 0 };
+    uint64_t magic = 0;
+    uint64_t num_tables = 0;
+    if (!reader.read(&magic, sizeof(magic)) || magic != BASIC_TABLES_MAGIC ||
+        !reader.read(&num_tables, sizeof(num_tables))) {
+        return false;
+    }
+
+    // Parse everything before touching the cache, so a malformed blob leaves it as it was
+    std::vector<BasicTable> tables(num_tables <= BasicTableId::NUM_BASIC_TABLES ? num_tables : 0);
+    if (tables.size() != num_tables) {
+        return false;
+    }
+    std::array<bool, BasicTableId::NUM_BASIC_TABLES> seen_ids{};
+    for (auto& table : tables) {
+        uint64_t id = 0;
+        uint64_t size = 0;
+        uint64_t use_twin_keys = 0;
+        if (!reader.read(&id, sizeof(id)) || id >= BasicTableId::NUM_BASIC_TABLES || !reader.read(&size, sizeof(size)) ||
+            !reader.read(&use_twin_keys, sizeof(use_twin_keys)) ||
+            !reader.read(&table.column_1_step_size, sizeof(bb::fr)) ||
+            !reader.read(&table.column_2_step_size, sizeof(bb::fr)) ||
+            !reader.read(&table.column_3_step_size, sizeof(bb::fr)) || !reader.read_frs(table.column_1, size) ||
+            !reader.read_frs(table.column_2, size) || !reader.read_frs(table.column_3, size)) {
+            return false;
+        }
+        // Only the first table with an id could make it into the cache
+        if (seen_ids[id]) {
+            return false;
+        }
+        seen_ids[id] = true;
+        table.id = static_cast<BasicTableId>(id);
+        table.table_index = 0;
+        table.size = size;
+        table.use_twin_keys = use_twin_keys != 0;
+        table.get_values_from_key = nullptr;
+    }
+
+    for (auto& table : tables) {
+        std::call_once(basic_table_init_flags[table.id], [&] { BASIC_TABLES[table.id] = std::move(table); });
+    }
+    return true;
+}
+
 } // namespace bb::plookup
@@ -1,5 +1,7 @@
 #pragma once
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <span>
+#include <vector>
 
 #include "./fixed_base/fixed_base.hpp"
 #include "aes128.hpp"
@@ -20,6 +22,28 @@ namespace bb::plookup {
 
 const MultiTable& create_table(MultiTableId id);
 
+/**
+ * @brief Get the basic table with the given id, generating it on first use
+ * @details Like multi-tables, basic tables are generated at most once per process and never modified afterwards. The
+ * returned table has table_index 0 and no lookup gates; circuit builders copy it and fill in both.
+ */
+const BasicTable& get_basic_table(BasicTableId id);
+
+/**
+ * @brief Serialize the basic tables with the given ids into a binary blob that load_basic_tables accepts
+ * @details Columns are stored as raw Montgomery form field elements, so a blob is only meant to be read back on a
+ * machine of the same endianness, e.g. to ship precomputed tables alongside a binary.
+ */
+std::vector<uint8_t> serialize_basic_tables(std::span<const BasicTableId> ids);
+
+/**
+ * @brief Populate the basic table cache from a blob produced by serialize_basic_tables, so that those tables are not
+ * generated at first use
+ * @details Tables that are already in the cache are left untouched. Loaded tables have a null get_values_from_key.
+ * Returns false, without loading anything, if the blob is malformed or holds an id more than once.
+ */
+bool load_basic_tables(std::span<const uint8_t> blob);
+
 ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_a,
                                          const bb::fr& key_b = 0,
@@ -177,11 +177,11 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
 {
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(challenge);
 
-    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma),L_1(\gamma)}
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/764): Generalize the vanishing polynomial formula
-    // and the computation of Lagrange basis for k instances
-    auto vanishing_polynomial_at_challenge = challenge * (challenge - FF(1));
-    std::vector<FF> lagranges{ FF(1) - challenge, challenge };
+    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma),...,L_{k-1}(\gamma)}
+    FF vanishing_polynomial_at_challenge;
+    std::array<FF, ProverInstances::NUM> lagranges;
+    std::tie(vanishing_polynomial_at_challenge, lagranges) =
+        compute_vanishing_polynomial_and_lagranges<ProverInstances::NUM>(challenge);
 
     auto next_accumulator = std::make_shared<Instance>();
     next_accumulator->is_accumulator = true;
@@ -205,27 +205,51 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
         polynomial = typename Flavor::Polynomial(instances[0]->instance_size);
     }
 
-    // Fold the prover polynomials
+    // Fold the prover polynomials: every row of every accumulator polynomial is the combination of the same row of the
+    // instances' polynomials with the Lagrange coefficients. Each thread folds all polynomials over its range of rows,
+    // reading the k inputs of a row together and writing the result once.
+    auto acc_polynomials = acc_prover_polynomials.get_all();
+    std::array<decltype(instances[0]->prover_polynomials.get_all()), ProverInstances::NUM> inst_polynomials;
     for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
-        for (auto [acc_poly, inst_poly] :
-             zip_view(acc_prover_polynomials.get_all(), instances[inst_idx]->prover_polynomials.get_all())) {
-            for (auto [acc_el, inst_el] : zip_view(acc_poly, inst_poly)) {
-                acc_el += inst_el * lagranges[inst_idx];
+        inst_polynomials[inst_idx] = instances[inst_idx]->prover_polynomials.get_all();
+    }
+    run_loop_in_parallel(instances[0]->instance_size, [&](size_t start, size_t end) {
+        for (size_t poly_idx = 0; poly_idx < acc_polynomials.size(); poly_idx++) {
+            auto& acc_poly = acc_polynomials[poly_idx];
+            for (size_t row = start; row < end; row++) {
+                FF acc_el = inst_polynomials[0][poly_idx][row] * lagranges[0];
+                for (size_t inst_idx = 1; inst_idx < ProverInstances::NUM; inst_idx++) {
+                    acc_el += inst_polynomials[inst_idx][poly_idx][row] * lagranges[inst_idx];
+                }
+                acc_poly[row] = acc_el;
             }
         }
-    }
+    });
     next_accumulator->prover_polynomials = std::move(acc_prover_polynomials);
 
-    // Fold the witness commtiments and send them to the verifier
+    // Fold the witness commitments and the verification keys together
     auto witness_labels = next_accumulator->commitment_labels.get_witness();
+    auto vk_labels = next_accumulator->commitment_labels.get_precomputed();
+    const size_t num_witness_commitments = next_accumulator->witness_commitments.get_all().size();
+    const size_t num_vk_commitments = instances[0]->verification_key->get_all().size();
+    std::vector<std::array<Commitment, ProverInstances::NUM>> commitments_to_fold(num_witness_commitments +
+                                                                                 num_vk_commitments);
+    for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
+        auto witness_commitments = instances[inst_idx]->witness_commitments.get_all();
+        auto vk_commitments = instances[inst_idx]->verification_key->get_all();
+        for (size_t idx = 0; idx < num_witness_commitments; idx++) {
+            commitments_to_fold[idx][inst_idx] = witness_commitments[idx];
+        }
+        for (size_t idx = 0; idx < num_vk_commitments; idx++) {
+            commitments_to_fold[num_witness_commitments + idx][inst_idx] = vk_commitments[idx];
+        }
+    }
+    auto folded_commitments = fold_commitments<typename Flavor::Curve>(commitments_to_fold, lagranges);
+
+    // Send the folded witness commitments to the verifier
     size_t comm_idx = 0;
     for (auto& acc_comm : next_accumulator->witness_commitments.get_all()) {
-        acc_comm = Commitment::infinity();
-        size_t inst_idx = 0;
-        for (auto& instance : instances) {
-            acc_comm = acc_comm + instance->witness_commitments.get_all()[comm_idx] * lagranges[inst_idx];
-            inst_idx++;
-        }
+        acc_comm = folded_commitments[comm_idx];
         transcript->send_to_verifier("next_" + witness_labels[comm_idx], acc_comm);
         comm_idx++;
     }
@@ -250,23 +274,29 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
     }
 
     // Evaluate the combined batching  α_i univariate at challenge to obtain next α_i and send it to the
-    // verifier, where i ∈ {0,...,NUM_SUBRELATIONS - 1}
+    // verifier, where i ∈ {0,...,NUM_SUBRELATIONS - 1}. The univariate interpolates the instances' α_i over {0,...,k-1},
+    // so its value at the challenge is their combination with the Lagrange coefficients.
     auto& folded_alphas = next_accumulator->alphas;
     for (size_t idx = 0; idx < NUM_SUBRELATIONS - 1; idx++) {
-        folded_alphas[idx] = instances.alphas[idx].evaluate(challenge);
+        folded_alphas[idx] = 0;
+        for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
+            folded_alphas[idx] += instances[inst_idx]->alphas[idx] * lagranges[inst_idx];
+        }
         transcript->send_to_verifier("next_alpha_" + std::to_string(idx), folded_alphas[idx]);
     }
 
     // Evaluate each relation parameter univariate at challenge to obtain the folded relation parameters and send to
     // the verifier
-    auto& combined_relation_parameters = instances.relation_parameters;
-    auto folded_relation_parameters = bb::RelationParameters<FF>{
-        combined_relation_parameters.eta.evaluate(challenge),
-        combined_relation_parameters.beta.evaluate(challenge),
-        combined_relation_parameters.gamma.evaluate(challenge),
-        combined_relation_parameters.public_input_delta.evaluate(challenge),
-        combined_relation_parameters.lookup_grand_product_delta.evaluate(challenge),
-    };
+    auto folded_relation_parameters = bb::RelationParameters<FF>{};
+    for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
+        const auto& relation_parameters = instances[inst_idx]->relation_parameters;
+        folded_relation_parameters.eta += relation_parameters.eta * lagranges[inst_idx];
+        folded_relation_parameters.beta += relation_parameters.beta * lagranges[inst_idx];
+        folded_relation_parameters.gamma += relation_parameters.gamma * lagranges[inst_idx];
+        folded_relation_parameters.public_input_delta += relation_parameters.public_input_delta * lagranges[inst_idx];
+        folded_relation_parameters.lookup_grand_product_delta +=
+            relation_parameters.lookup_grand_product_delta * lagranges[inst_idx];
+    }
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/805): Add the relation parameters to the transcript
     // together.
     transcript->send_to_verifier("next_eta", folded_relation_parameters.eta);
@@ -277,19 +307,13 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
                                  folded_relation_parameters.lookup_grand_product_delta);
     next_accumulator->relation_parameters = folded_relation_parameters;
 
-    // Fold the verification key and send it to the verifier as this is part of ϕ as well
+    // Send the folded verification key to the verifier as this is part of ϕ as well
     auto acc_vk = std::make_shared<VerificationKey>(instances[0]->prover_polynomials.get_polynomial_size(),
                                                     instances[0]->public_inputs.size());
-    auto labels = next_accumulator->commitment_labels.get_precomputed();
     size_t vk_idx = 0;
     for (auto& vk : acc_vk->get_all()) {
-        size_t inst = 0;
-        vk = Commitment::infinity();
-        for (auto& instance : instances) {
-            vk = vk + (instance->verification_key->get_all()[vk_idx]) * lagranges[inst];
-            inst++;
-        }
-        transcript->send_to_verifier("next_" + labels[vk_idx], vk);
+        vk = folded_commitments[num_witness_commitments + vk_idx];
+        transcript->send_to_verifier("next_" + vk_labels[vk_idx], vk);
         vk_idx++;
     }
     next_accumulator->verification_key = acc_vk;
@@ -356,4 +380,10 @@ FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstanc
 
 template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>;
 template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 2>>;
+template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 4>>;
+template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 4>>;
+template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 8>>;
+template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 8>>;
+template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 16>>;
+template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 16>>;
 } // namespace bb
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/protogalaxy/folding_result.hpp"
+#include "barretenberg/protogalaxy/prover_verifier_shared.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/sumcheck/instance/instances.hpp"
@@ -378,24 +379,38 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     /**
      * @brief Compute the combiner quotient defined as $K$ polynomial in the paper.
      *
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/764): generalize the computation of vanishing
-     * polynomials and Lagrange basis and use batch_invert.
-     *
+     * @details K(X) = (G(X) - F(α)⋅L_0(X)) / Z(X), where Z is the vanishing polynomial of the domain {0, ..., k - 1} of
+     * the k instances and L_0 the first Lagrange polynomial over it. K is represented by its evaluations on the points
+     * of the combiner domain outside {0, ..., k - 1}.
      */
     static Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> compute_combiner_quotient(
         const FF compressed_perturbator, ExtendedUnivariateWithRandomization combiner)
     {
-        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - ProverInstances::NUM> combiner_quotient_evals = {};
+        constexpr size_t NUM = ProverInstances::NUM;
+        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - NUM> combiner_quotient_evals = {};
+        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - NUM> vanishing_polynomial_evals = {};
+
+        // L_0(X) = ∏_{j=1}^{k-1} (X - j) / (0 - j) and Z(X) = X⋅∏_{j=1}^{k-1} (X - j)
+        FF lagrange_0_denominator(1);
+        for (size_t j = 1; j < NUM; j++) {
+            lagrange_0_denominator *= -FF(j);
+        }
+        const FF lagrange_0_denominator_inverse = lagrange_0_denominator.invert();
 
         // Compute the combiner quotient polynomial as evaluations on points that are not in the vanishing set.
-        //
-        for (size_t point = ProverInstances::NUM; point < combiner.size(); point++) {
-            auto idx = point - ProverInstances::NUM;
-            auto lagrange_0 = FF(1) - FF(point);
-            auto vanishing_polynomial = FF(point) * (FF(point) - 1);
-
-            combiner_quotient_evals[idx] =
-                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial.invert();
+        for (size_t point = NUM; point < combiner.size(); point++) {
+            auto idx = point - NUM;
+            FF lagrange_0_numerator(1);
+            for (size_t j = 1; j < NUM; j++) {
+                lagrange_0_numerator *= FF(point) - FF(j);
+            }
+            auto lagrange_0 = lagrange_0_numerator * lagrange_0_denominator_inverse;
+            vanishing_polynomial_evals[idx] = FF(point) * lagrange_0_numerator;
+            combiner_quotient_evals[idx] = combiner.value_at(point) - compressed_perturbator * lagrange_0;
+        }
+        FF::batch_invert(vanishing_polynomial_evals);
+        for (size_t idx = 0; idx < combiner_quotient_evals.size(); idx++) {
+            combiner_quotient_evals[idx] *= vanishing_polynomial_evals[idx];
         }
 
         Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> combiner_quotient(
@@ -456,8 +471,6 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * @param combiner_quotient polynomial K in the paper
      * @param challenge
      * @param compressed_perturbator
-     *
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/796): optimise the construction of the new accumulator
      */
     std::shared_ptr<Instance> compute_next_accumulator(
         ProverInstances& instances,
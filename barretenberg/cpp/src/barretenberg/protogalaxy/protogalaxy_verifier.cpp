@@ -208,8 +208,8 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(const std::ve
     FF combiner_challenge = transcript->template get_challenge<FF>("combiner_quotient_challenge");
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(combiner_challenge);
 
-    auto vanishing_polynomial_at_challenge = combiner_challenge * (combiner_challenge - FF(1));
-    auto lagranges = std::vector<FF>{ FF(1) - combiner_challenge, combiner_challenge };
+    auto [vanishing_polynomial_at_challenge, lagranges] =
+        compute_vanishing_polynomial_and_lagranges<VerifierInstances::NUM>(combiner_challenge);
 
     // Compute next folding parameters and verify against the ones received from the prover
     auto expected_next_target_sum =
@@ -222,20 +222,29 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(const std::ve
         verified = verified & (expected_betas_star[idx] == beta_star);
     }
 
-    // Compute ϕ and verify against the data received from the prover
-    WitnessCommitments acc_witness_commitments;
+    // Compute ϕ and verify against the data received from the prover. The witness commitments and the verification
+    // keys are folded together.
     auto witness_labels = commitment_labels.get_witness();
-    size_t comm_idx = 0;
-    for (auto& expected_comm : acc_witness_commitments.get_all()) {
-        expected_comm = Commitment::infinity();
-        size_t inst = 0;
-        for (auto& instance : instances) {
-            expected_comm = expected_comm + instance->witness_commitments.get_all()[comm_idx] * lagranges[inst];
-            inst++;
+    auto vk_labels = commitment_labels.get_precomputed();
+    const size_t num_witness_commitments = instances[0]->witness_commitments.get_all().size();
+    const size_t num_vk_commitments = instances[0]->verification_key->get_all().size();
+    std::vector<std::array<Commitment, VerifierInstances::NUM>> commitments_to_fold(num_witness_commitments +
+                                                                                   num_vk_commitments);
+    for (size_t inst_idx = 0; inst_idx < VerifierInstances::NUM; inst_idx++) {
+        auto witness_commitments = instances[inst_idx]->witness_commitments.get_all();
+        auto vk_commitments = instances[inst_idx]->verification_key->get_all();
+        for (size_t idx = 0; idx < num_witness_commitments; idx++) {
+            commitments_to_fold[idx][inst_idx] = witness_commitments[idx];
+        }
+        for (size_t idx = 0; idx < num_vk_commitments; idx++) {
+            commitments_to_fold[num_witness_commitments + idx][inst_idx] = vk_commitments[idx];
         }
+    }
+    auto expected_commitments = fold_commitments<typename Flavor::Curve>(commitments_to_fold, lagranges);
+
+    for (size_t comm_idx = 0; comm_idx < num_witness_commitments; comm_idx++) {
         auto comm = transcript->template receive_from_prover<Commitment>("next_" + witness_labels[comm_idx]);
-        verified = verified & (comm == expected_comm);
-        comm_idx++;
+        verified = verified & (comm == expected_commitments[comm_idx]);
     }
 
     std::vector<FF> folded_public_inputs(instances[0]->public_inputs.size(), 0);
@@ -292,19 +301,9 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(const std::ve
         transcript->template receive_from_prover<FF>("next_lookup_grand_product_delta");
     verified = verified & (next_lookup_grand_product_delta == expected_parameters.lookup_grand_product_delta);
 
-    auto acc_vk = std::make_shared<VerificationKey>(instances[0]->instance_size, instances[0]->public_input_size);
-    auto vk_labels = commitment_labels.get_precomputed();
-    size_t vk_idx = 0;
-    for (auto& expected_vk : acc_vk->get_all()) {
-        size_t inst = 0;
-        expected_vk = Commitment::infinity();
-        for (auto& instance : instances) {
-            expected_vk = expected_vk + instance->verification_key->get_all()[vk_idx] * lagranges[inst];
-            inst++;
-        }
+    for (size_t vk_idx = 0; vk_idx < num_vk_commitments; vk_idx++) {
         auto vk = transcript->template receive_from_prover<Commitment>("next_" + vk_labels[vk_idx]);
-        verified = verified & (vk == expected_vk);
-        vk_idx++;
+        verified = verified & (vk == expected_commitments[num_witness_commitments + vk_idx]);
     }
 
     return verified;
@@ -312,4 +311,10 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(const std::ve
 
 template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 2>>;
 template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 2>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 4>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 4>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 8>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 8>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<UltraFlavor, 16>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<GoblinUltraFlavor, 16>>;
 } // namespace bb
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/polynomials/barycentric.hpp"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Evaluate at a challenge γ the vanishing polynomial Z(X) = X(X - 1)...(X - (NUM - 1)) of the domain {0, ...,
+ * NUM - 1} indexing the instances being folded, and the Lagrange basis L_0(X), ..., L_{NUM - 1}(X) over that domain.
+ *
+ * @details Each L_i(γ) = ∏_{j≠i}(γ - j) / ∏_{j≠i}(i - j) is assembled from prefix and suffix products of the factors
+ * (γ - j), so no value depending on γ is ever inverted. This is shared by the native and recursive folding verifiers,
+ * where it keeps the number of gates linear in NUM.
+ *
+ * @return The pair (Z(γ), {L_i(γ)})
+ */
+template <size_t NUM, typename FF>
+std::pair<FF, std::array<FF, NUM>> compute_vanishing_polynomial_and_lagranges(const FF& challenge)
+{
+    static_assert(NUM > 1, "Must fold at least two instances");
+    using Data = BarycentricData<FF, NUM, NUM>;
+
+    // prefix_products[i] = ∏_{j < i}(γ - j) and suffix_products[i] = ∏_{j >= i}(γ - j)
+    std::array<FF, NUM + 1> prefix_products;
+    std::array<FF, NUM + 1> suffix_products;
+    prefix_products[0] = FF(1);
+    for (size_t j = 0; j < NUM; j++) {
+        prefix_products[j + 1] = prefix_products[j] * (challenge - FF(j));
+    }
+    suffix_products[NUM] = FF(1);
+    for (size_t j = NUM - 1; j > 0; j--) {
+        suffix_products[j] = suffix_products[j + 1] * (challenge - FF(j));
+    }
+
+    std::array<FF, NUM> lagranges;
+    for (size_t i = 0; i < NUM; i++) {
+        lagranges[i] = prefix_products[i] * suffix_products[i + 1] / Data::lagrange_denominators[i];
+    }
+    return { prefix_products[NUM], lagranges };
+}
+
+/**
+ * @brief For every entry of commitments, which holds the same commitment from each of the NUM instances being folded,
+ * compute its folded value Σ_i L_i(γ)⋅[C_i].
+ *
+ * @details The linear combinations are computed in parallel in projective coordinates and only converted back to
+ * affine form at the end, with a single batched inversion for all of them.
+ */
+template <typename Curve, size_t NUM>
+std::vector<typename Curve::AffineElement> fold_commitments(
+    const std::vector<std::array<typename Curve::AffineElement, NUM>>& commitments,
+    const std::array<typename Curve::ScalarField, NUM>& lagranges)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    std::vector<Element> folded(commitments.size());
+    parallel_for(commitments.size(), [&](size_t idx) {
+        Element result = Element(commitments[idx][0]) * lagranges[0];
+        for (size_t inst_idx = 1; inst_idx < NUM; inst_idx++) {
+            result += Element(commitments[idx][inst_idx]) * lagranges[inst_idx];
+        }
+        folded[idx] = result;
+    });
+    Element::batch_normalize(folded.data(), folded.size());
+
+    std::vector<AffineElement> result(folded.size());
+    for (size_t idx = 0; idx < folded.size(); idx++) {
+        result[idx] = AffineElement(folded[idx].x, folded[idx].y);
+        if (folded[idx].is_point_at_infinity()) {
+            result[idx].self_set_infinity();
+        }
+    }
+    return result;
+}
+
+} // namespace bb
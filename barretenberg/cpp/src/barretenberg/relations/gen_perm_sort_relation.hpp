@@ -14,6 +14,11 @@ template <typename FF_> class GenPermSortRelationImpl {
         6  // range constrain sub-relation 4
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     */
+    template <typename AllEntities> inline static bool skip(const AllEntities& in) { return in.q_sort.is_zero(); }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The relation is defined as C(in(X)...) =
@@ -229,6 +229,42 @@ template <typename Settings, typename FF_> class GenericLookupRelationImpl {
         return std::get<INVERSE_POLYNOMIAL_INDEX>(Settings::get_nonconst_entities(in));
     }
 
+    /**
+     * @brief Whether any read or write term is computed by the Settings from entities outside of its entity tuple
+     */
+    static constexpr bool has_arbitrary_terms()
+    {
+        for (size_t i = 0; i < READ_TERMS; ++i) {
+            if (Settings::READ_TERM_TYPES[i] == READ_ARBITRARY) {
+                return true;
+            }
+        }
+        for (size_t i = 0; i < WRITE_TERMS; ++i) {
+            if (Settings::WRITE_TERM_TYPES[i] == WRITE_ARBITRARY) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Get all the entities used by the lookup, so that computing the inverse polynomial only has to fetch those
+     * @details Only available when all terms are tuples, since arbitrary terms may use other entities
+     */
+    template <typename AllEntities>
+    static auto get_const_entities(const AllEntities& in)
+        requires(!has_arbitrary_terms())
+    {
+        return Settings::get_const_entities(in);
+    }
+
+    template <typename AllEntities>
+    static auto get_nonconst_entities(AllEntities& in)
+        requires(!has_arbitrary_terms())
+    {
+        return Settings::get_nonconst_entities(in);
+    }
+
     /**
      * @brief Get selector/wire switching on(1) or off(0) inverse computation
      *
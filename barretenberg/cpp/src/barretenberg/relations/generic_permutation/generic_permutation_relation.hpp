@@ -79,6 +79,20 @@ template <typename Settings, typename FF_> class GenericPermutationRelationImpl
         return std::get<INVERSE_POLYNOMIAL_INDEX>(Settings::get_nonconst_entities(in));
     }
 
+    /**
+     * @brief Get all the entities used by the permutation, so that computing the inverse polynomial only has to fetch
+     * those
+     */
+    template <typename AllEntities> static auto get_const_entities(const AllEntities& in)
+    {
+        return Settings::get_const_entities(in);
+    }
+
+    template <typename AllEntities> static auto get_nonconst_entities(AllEntities& in)
+    {
+        return Settings::get_nonconst_entities(in);
+    }
+
     /**
      * @brief Get selector/wire switching on(1) or off(0) inverse computation
      * We turn it on if either of the permutation contribution selectors are active
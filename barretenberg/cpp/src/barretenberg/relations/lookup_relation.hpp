@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 
 namespace bb {
@@ -48,6 +49,35 @@ template <typename FF_> class LookupRelationImpl {
      */
     inline static auto& get_shifted_grand_product_polynomial(auto& input) { return input.z_lookup_shift; }
 
+    /**
+     * @brief Get the entities read by the grand product numerator and denominator, so that only these are gathered
+     * when the grand product polynomial is computed
+     */
+    inline static auto get_grand_product_entities(auto& in)
+    {
+        return RefArray{ in.w_l,
+                         in.w_r,
+                         in.w_o,
+                         in.w_l_shift,
+                         in.w_r_shift,
+                         in.w_o_shift,
+                         in.table_1,
+                         in.table_2,
+                         in.table_3,
+                         in.table_4,
+                         in.table_1_shift,
+                         in.table_2_shift,
+                         in.table_3_shift,
+                         in.table_4_shift,
+                         in.q_o,
+                         in.q_r,
+                         in.q_m,
+                         in.q_c,
+                         in.q_lookup,
+                         in.sorted_accum,
+                         in.sorted_accum_shift };
+    }
+
     /**
      * @brief Compute numerator term of the lookup relation:
      *
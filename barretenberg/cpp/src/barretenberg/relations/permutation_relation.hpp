@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 
 namespace bb {
@@ -20,6 +21,26 @@ template <typename FF_> class UltraPermutationRelationImpl {
     inline static auto& get_grand_product_polynomial(auto& in) { return in.z_perm; }
     inline static auto& get_shifted_grand_product_polynomial(auto& in) { return in.z_perm_shift; }
 
+    /**
+     * @brief Get the entities read by the grand product numerator and denominator, so that only these are gathered
+     * when the grand product polynomial is computed
+     */
+    inline static auto get_grand_product_entities(auto& in)
+    {
+        return RefArray{ in.w_l,
+                         in.w_r,
+                         in.w_o,
+                         in.w_4,
+                         in.id_1,
+                         in.id_2,
+                         in.id_3,
+                         in.id_4,
+                         in.sigma_1,
+                         in.sigma_2,
+                         in.sigma_3,
+                         in.sigma_4 };
+    }
+
     template <typename Accumulator, typename AllEntities, typename Parameters>
     inline static Accumulator compute_grand_product_numerator(const AllEntities& in, const Parameters& params)
     {
@@ -31,6 +31,18 @@ concept HasSubrelationLinearlyIndependentMember = requires(T) {
 template <typename T>
 concept HasParameterLengthAdjustmentsMember = requires { T::TOTAL_LENGTH_ADJUSTMENTS; };
 
+/**
+ * @brief A relation is skippable if it exposes a static `skip` method that tells, from the inputs alone, whether the
+ * contribution of all of its subrelations is identically zero. This is the case for relations gated by a selector, on
+ * the (usually many) rows where that selector is zero.
+ */
+template <typename Relation, typename AllEntities>
+concept isSkippable = requires(const AllEntities& input) {
+                          {
+                              Relation::skip(input)
+                              } -> std::same_as<bool>;
+                      };
+
 /**
  * @brief Check whether a given subrelation is linearly independent from the other subrelations.
  *
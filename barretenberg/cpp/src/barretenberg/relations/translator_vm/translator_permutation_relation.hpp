@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 
 namespace bb {
@@ -17,6 +18,24 @@ template <typename FF_> class GoblinTranslatorPermutationRelationImpl {
     inline static auto& get_grand_product_polynomial(auto& in) { return in.z_perm; }
     inline static auto& get_shifted_grand_product_polynomial(auto& in) { return in.z_perm_shift; }
 
+    /**
+     * @brief Get the entities read by the grand product numerator and denominator, so that only these are gathered
+     * when the grand product polynomial is computed
+     */
+    inline static auto get_grand_product_entities(auto& in)
+    {
+        return RefArray{ in.concatenated_range_constraints_0,
+                         in.concatenated_range_constraints_1,
+                         in.concatenated_range_constraints_2,
+                         in.concatenated_range_constraints_3,
+                         in.ordered_extra_range_constraints_numerator,
+                         in.ordered_range_constraints_0,
+                         in.ordered_range_constraints_1,
+                         in.ordered_range_constraints_2,
+                         in.ordered_range_constraints_3,
+                         in.ordered_range_constraints_4 };
+    }
+
     template <typename Accumulator, typename AllEntities, typename Parameters>
     inline static Accumulator compute_grand_product_numerator(const AllEntities& in, const Parameters& params)
     {
@@ -109,6 +109,24 @@ class UltraRelationConsistency : public testing::Test {
         Relation::accumulate(accumulator, input_elements, parameters, 1);
         EXPECT_EQ(accumulator, expected_values);
     };
+
+    /**
+     * @brief Check that a relation is skipped exactly when its selector vanishes, and that it contributes nothing then
+     */
+    template <typename Relation>
+    static void validate_relation_skipping(InputElements& input_elements, FF& selector, const auto& parameters)
+    {
+        EXPECT_FALSE(Relation::skip(input_elements));
+
+        selector = FF(0);
+        EXPECT_TRUE(Relation::skip(input_elements));
+        typename Relation::SumcheckArrayOfValuesOverSubrelations accumulator;
+        std::fill(accumulator.begin(), accumulator.end(), FF(0));
+        Relation::accumulate(accumulator, input_elements, parameters, 1);
+        for (auto& value : accumulator) {
+            EXPECT_EQ(value, FF(0));
+        }
+    };
 };
 
 TEST_F(UltraRelationConsistency, UltraArithmeticRelation)
@@ -678,3 +696,21 @@ TEST_F(UltraRelationConsistency, Poseidon2InternalRelation)
     run_test(/*random_inputs=*/false);
     run_test(/*random_inputs=*/true);
 };
+
+TEST_F(UltraRelationConsistency, SkippableRelations)
+{
+    const auto parameters = RelationParameters<FF>::get_random();
+    auto input_elements = InputElements::get_special();
+    validate_relation_skipping<UltraArithmeticRelation<FF>>(input_elements, input_elements.q_arith, parameters);
+    validate_relation_skipping<GenPermSortRelation<FF>>(input_elements, input_elements.q_sort, parameters);
+    validate_relation_skipping<EllipticRelation<FF>>(input_elements, input_elements.q_elliptic, parameters);
+    validate_relation_skipping<AuxiliaryRelation<FF>>(input_elements, input_elements.q_aux, parameters);
+    validate_relation_skipping<Poseidon2ExternalRelation<FF>>(
+        input_elements, input_elements.q_poseidon2_external, parameters);
+    validate_relation_skipping<Poseidon2InternalRelation<FF>>(
+        input_elements, input_elements.q_poseidon2_internal, parameters);
+
+    // Relations that are not gated by a selector can never be skipped
+    static_assert(!isSkippable<UltraPermutationRelation<FF>, InputElements>);
+    static_assert(!isSkippable<LookupRelation<FF>, InputElements>);
+}
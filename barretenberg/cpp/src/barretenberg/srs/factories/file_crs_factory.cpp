@@ -6,9 +6,36 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "point_table_cache.hpp"
 
 namespace bb::srs::factories {
 
+template <typename Curve>
+FileProverCrs<Curve>::FileProverCrs(const size_t num_points, std::string const& path, bool use_point_table_cache)
+    : num_points(num_points)
+{
+    const std::string cache_path = PointTableCache<Curve>::get_path(path);
+    // Identifies the transcript the cached table was built from
+    uint64_t source_hash = 0;
+    if (use_point_table_cache) {
+        source_hash = PointTableCache<Curve>::hash_source(srs::IO<Curve>::get_transcript_paths(path));
+        monomials_ = PointTableCache<Curve>::map(cache_path, num_points, source_hash);
+        if (monomials_) {
+            return;
+        }
+    }
+
+    monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+
+    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+
+    if (use_point_table_cache &&
+        !PointTableCache<Curve>::write(cache_path, monomials_.get(), num_points, source_hash)) {
+        info("could not write pippenger point table cache to ", cache_path);
+    }
+}
+
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines((bb::pairing::miller_lines*)(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
 {
@@ -47,16 +74,17 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, bool use_point_table_cache)
     : path_(std::move(path))
     , degree_(initial_degree)
+    , use_point_table_cache_(use_point_table_cache)
 {}
 
 template <typename Curve>
 std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, use_point_table_cache_);
         degree_ = degree;
     }
     return prover_crs_;
@@ -12,10 +12,13 @@ namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * If `use_point_table_cache` is set, the prover crs is memory mapped from a pippenger point table cached next to the
+ * transcripts (see PointTableCache), which is created on first use.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, bool use_point_table_cache = false);
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -25,20 +28,14 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
+    bool use_point_table_cache_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
-        : num_points(num_points)
-    {
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
-    };
+    FileProverCrs(const size_t num_points, std::string const& path, bool use_point_table_cache = false);
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
 
@@ -16,6 +16,15 @@ template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
     }
 
+    /**
+     * @brief Adopt a point table that is already in the form produced by generate_pippenger_point_table, i.e. the
+     * points interleaved with their endomorphism images, without copying it.
+     */
+    MemProverCrs(std::shared_ptr<typename Curve::AffineElement[]> point_table, size_t num_points)
+        : num_points(num_points)
+        , monomials_(std::move(point_table))
+    {}
+
     typename Curve::AffineElement* get_monomial_points() override { return monomials_.get(); }
 
     size_t get_monomial_size() const override { return num_points; }
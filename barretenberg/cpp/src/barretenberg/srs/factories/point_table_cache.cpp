@@ -0,0 +1,188 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs {
+
+namespace {
+// 64 bit FNV-1a
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+void fnv_combine(uint64_t& hash, uint8_t byte)
+{
+    hash ^= byte;
+    hash *= 0x100000001b3ULL;
+}
+void fnv_combine(uint64_t& hash, uint64_t value)
+{
+    for (size_t i = 0; i < sizeof(value); ++i) {
+        fnv_combine(hash, static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/**
+ * @brief The hash stored in the header of a table, which also covers the number of points of the table so that a
+ * header claiming more points than were written is rejected
+ */
+uint64_t table_hash(uint64_t source_hash, uint64_t num_points)
+{
+    uint64_t hash = source_hash;
+    fnv_combine(hash, num_points);
+    // 0 is reserved for "no source"
+    return hash == 0 ? 1 : hash;
+}
+} // namespace
+
+template <typename Curve> std::string PointTableCache<Curve>::get_path(std::string const& dir)
+{
+    return format(dir, "/monomial/pippenger_point_table.dat");
+}
+
+template <typename Curve>
+uint64_t PointTableCache<Curve>::hash_source(std::vector<std::string> const& source_paths)
+{
+#ifndef __wasm__
+    // Enough for the transcript header and the first and last points, reading the whole transcripts would defeat the
+    // cache
+    constexpr size_t NUM_SAMPLED_BYTES = 1 << 16;
+
+    if (source_paths.empty()) {
+        return 0;
+    }
+    uint64_t hash = FNV_OFFSET_BASIS;
+    std::vector<char> bytes(NUM_SAMPLED_BYTES);
+    for (auto const& source_path : source_paths) {
+        struct stat st;
+        std::ifstream file(source_path, std::ios::binary);
+        if (!file || stat(source_path.c_str(), &st) != 0) {
+            return 0;
+        }
+        const auto file_size = static_cast<size_t>(st.st_size);
+        fnv_combine(hash, static_cast<uint64_t>(file_size));
+        fnv_combine(hash, static_cast<uint64_t>(st.st_mtim.tv_sec));
+        fnv_combine(hash, static_cast<uint64_t>(st.st_mtim.tv_nsec));
+
+        // The head and the tail of the file, which overlap for small files
+        const size_t sample_size = std::min(file_size, NUM_SAMPLED_BYTES);
+        for (const size_t offset : { size_t(0), file_size - sample_size }) {
+            file.seekg(static_cast<std::streamoff>(offset));
+            file.read(bytes.data(), static_cast<std::streamsize>(sample_size));
+            if (!file) {
+                return 0;
+            }
+            for (size_t i = 0; i < sample_size; ++i) {
+                fnv_combine(hash, static_cast<uint8_t>(bytes[i]));
+            }
+        }
+    }
+    return hash;
+#else
+    static_cast<void>(source_paths);
+    return 0;
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> PointTableCache<Curve>::map(std::string const& path,
+                                                                             size_t num_points,
+                                                                             uint64_t source_hash)
+{
+#ifndef __wasm__
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    PointTableHeader header;
+    struct stat st;
+    const bool header_ok = fstat(fd, &st) == 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                           header.magic == PointTableHeader::MAGIC &&
+                           header.field_modulus_lo == Curve::BaseField::modulus.data[0] &&
+                           header.element_size == sizeof(AffineElement) && header.num_points >= num_points &&
+                           source_hash != 0 && header.source_hash == table_hash(source_hash, header.num_points) &&
+                           (size_t)st.st_size >= sizeof(header) + 2 * header.num_points * sizeof(AffineElement);
+    if (!header_ok) {
+        close(fd);
+        return nullptr;
+    }
+
+    const size_t map_size = (size_t)st.st_size;
+    void* data = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping holds its own reference to the file.
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto* points = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(data) + sizeof(PointTableHeader));
+    return std::shared_ptr<AffineElement[]>(points, [data, map_size](AffineElement*) { munmap(data, map_size); });
+#else
+    static_cast<void>(path);
+    static_cast<void>(num_points);
+    static_cast<void>(source_hash);
+    return nullptr;
+#endif
+}
+
+template <typename Curve>
+bool PointTableCache<Curve>::write(std::string const& path,
+                                   AffineElement const* table,
+                                   size_t num_points,
+                                   uint64_t source_hash)
+{
+#ifndef __wasm__
+    // Zeroed first so that the padding written to the file is deterministic
+    PointTableHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = PointTableHeader::MAGIC;
+    header.field_modulus_lo = Curve::BaseField::modulus.data[0];
+    header.element_size = sizeof(AffineElement);
+    header.num_points = num_points;
+    header.source_hash = table_hash(source_hash, num_points);
+
+    // Writing to a per-process temporary file and renaming means concurrent readers see either the old table or the
+    // new one, and concurrent writers do not interleave.
+    const std::string tmp_path = format(path, ".", getpid(), ".tmp");
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const*>(table), (std::streamsize)(2 * num_points * sizeof(AffineElement)));
+        if (!file) {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+#else
+    // Without mmap there is no way to consume the table, so don't bother writing it.
+    static_cast<void>(path);
+    static_cast<void>(table);
+    static_cast<void>(num_points);
+    static_cast<void>(source_hash);
+    return false;
+#endif
+}
+
+template class PointTableCache<curve::BN254>;
+template class PointTableCache<curve::Grumpkin>;
+
+} // namespace bb::srs
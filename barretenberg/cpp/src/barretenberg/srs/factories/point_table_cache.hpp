@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bb::srs {
+
+/**
+ * @brief Header of a cached pippenger point table file
+ *
+ * @details A point table file stores the output of `scalar_multiplication::generate_pippenger_point_table`, i.e. the
+ * SRS points interleaved with their endomorphism images, already converted to little-endian Montgomery form. It can
+ * therefore be memory mapped and handed directly to pippenger without any parsing. The file has the following
+ * structure:
+ *
+ * 00   | PointTableHeader                | padded to 64 bytes so the point data is cache-line aligned
+ * 40   | P_0 | \beta P_0 | P_1 | \beta P_1 | ...   2 * num_points * sizeof(AffineElement) bytes
+ *
+ * The first `2 * k` entries of a table built for `num_points` points are exactly the table for `k <= num_points`
+ * points, so a single file serves every smaller degree.
+ */
+struct alignas(64) PointTableHeader {
+    static constexpr uint64_t MAGIC = 0x3230424154505442; // "BTPTAB02"
+
+    uint64_t magic;
+    uint64_t field_modulus_lo;
+    uint64_t element_size;
+    uint64_t num_points;
+    // PointTableCache::hash_source of the transcript files, combined with num_points
+    uint64_t source_hash;
+};
+static_assert(sizeof(PointTableHeader) == 64);
+
+template <typename Curve> class PointTableCache {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    static std::string get_path(std::string const& dir);
+
+    /**
+     * @brief Hash the size, modification time, and leading and trailing bytes of every transcript file a table is
+     * built from
+     *
+     * @details Stored in the table so that a table is not used once any transcript it was built from is replaced.
+     * Returns 0 if there are no files or one of them cannot be read.
+     */
+    static uint64_t hash_source(std::vector<std::string> const& source_paths);
+
+    /**
+     * @brief Map the point table stored at `path` read-only into memory
+     *
+     * @details The mapping is shared, so concurrent prover processes on the same host use a single page-cache copy
+     * of the table. Returns nullptr if the file is missing, malformed, built for another curve or from a transcript
+     * whose hash is not `source_hash`, or holds fewer than `num_points` points. The mapping is released when the last
+     * copy of the returned pointer is destroyed.
+     */
+    static std::shared_ptr<AffineElement[]> map(std::string const& path, size_t num_points, uint64_t source_hash);
+
+    /**
+     * @brief Write a pippenger point table holding `num_points` points, built from the transcript hashing to
+     * `source_hash`, to `path`
+     *
+     * @details The file is written to a temporary path and renamed into place, so readers never observe a partially
+     * written table. Returns false if the table could not be written.
+     */
+    static bool write(std::string const& path, AffineElement const* table, size_t num_points, uint64_t source_hash);
+};
+
+} // namespace bb::srs
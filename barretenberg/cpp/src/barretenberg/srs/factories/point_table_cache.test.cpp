@@ -0,0 +1,184 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb;
+using namespace bb::srs;
+
+namespace {
+template <typename Curve> std::vector<typename Curve::AffineElement> random_points(size_t num_points)
+{
+    std::vector<typename Curve::AffineElement> points(num_points);
+    for (auto& point : points) {
+        point = Curve::AffineElement::random_element();
+    }
+    return points;
+}
+
+// Hash of the transcript the tables of the tests are supposedly built from
+constexpr uint64_t SOURCE_HASH = 0x1234;
+
+// Unique per process and test, so that concurrent runs of the tests do not share files
+std::string temp_path(std::string const& suffix)
+{
+    return (std::filesystem::temp_directory_path() /
+            ("bb_" + std::to_string(getpid()) + "_" +
+             ::testing::UnitTest::GetInstance()->current_test_info()->name() + suffix))
+        .string();
+}
+} // namespace
+
+template <typename Curve> class PointTableCacheTest : public ::testing::Test {
+  public:
+    std::string path = temp_path(".dat");
+
+    void TearDown() override { std::filesystem::remove(path); }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(PointTableCacheTest, Curves);
+
+TYPED_TEST(PointTableCacheTest, MappedTableMatchesGeneratedTable)
+{
+    using Curve = TypeParam;
+    constexpr size_t num_points = 256;
+    auto points = random_points<Curve>(num_points);
+    factories::MemProverCrs<Curve> crs(points);
+
+    EXPECT_TRUE(PointTableCache<Curve>::write(this->path, crs.get_monomial_points(), num_points, SOURCE_HASH));
+
+    // A table can serve any degree up to the one it was built for.
+    for (size_t degree : { num_points, num_points / 2 }) {
+        auto mapped = PointTableCache<Curve>::map(this->path, degree, SOURCE_HASH);
+        ASSERT_NE(mapped, nullptr);
+        EXPECT_EQ(memcmp(mapped.get(), crs.get_monomial_points(), sizeof(typename Curve::AffineElement) * 2 * degree),
+                  0);
+    }
+}
+
+TYPED_TEST(PointTableCacheTest, RejectsUnusableTables)
+{
+    using Curve = TypeParam;
+    constexpr size_t num_points = 16;
+    auto points = random_points<Curve>(num_points);
+    factories::MemProverCrs<Curve> crs(points);
+
+    EXPECT_EQ(PointTableCache<Curve>::map(this->path, num_points, SOURCE_HASH), nullptr);
+
+    EXPECT_TRUE(PointTableCache<Curve>::write(this->path, crs.get_monomial_points(), num_points, SOURCE_HASH));
+    EXPECT_EQ(PointTableCache<Curve>::map(this->path, num_points + 1, SOURCE_HASH), nullptr);
+
+    // The table was built from another transcript, or the transcript is missing.
+    EXPECT_EQ(PointTableCache<Curve>::map(this->path, num_points, SOURCE_HASH + 1), nullptr);
+    EXPECT_EQ(PointTableCache<Curve>::map(this->path, num_points, 0), nullptr);
+
+    // The number of points in the header no longer matches the one the table was written with.
+    {
+        std::fstream file(this->path, std::ios::binary | std::ios::in | std::ios::out);
+        const uint64_t fewer_points = num_points - 1;
+        file.seekp(offsetof(PointTableHeader, num_points));
+        file.write(reinterpret_cast<char const*>(&fewer_points), sizeof(fewer_points));
+    }
+    EXPECT_EQ(PointTableCache<Curve>::map(this->path, 1, SOURCE_HASH), nullptr);
+
+    // Truncate the file so that it no longer holds the number of points its header claims.
+    std::filesystem::resize_file(this->path, sizeof(PointTableHeader) + sizeof(typename Curve::AffineElement));
+    EXPECT_EQ(PointTableCache<Curve>::map(this->path, 1, SOURCE_HASH), nullptr);
+}
+
+TEST(PointTableCacheTest, RejectsTableForOtherCurve)
+{
+    constexpr size_t num_points = 16;
+    auto points = random_points<curve::BN254>(num_points);
+    factories::MemProverCrs<curve::BN254> crs(points);
+    std::string path = temp_path(".dat");
+
+    EXPECT_TRUE(PointTableCache<curve::BN254>::write(path, crs.get_monomial_points(), num_points, SOURCE_HASH));
+    EXPECT_EQ(PointTableCache<curve::Grumpkin>::map(path, num_points, SOURCE_HASH), nullptr);
+    std::filesystem::remove(path);
+}
+
+TEST(PointTableCacheTest, SourceHashDependsOnTranscripts)
+{
+    using Cache = PointTableCache<curve::BN254>;
+    const std::vector<std::string> paths = { temp_path(".transcript00"), temp_path(".transcript01") };
+    auto write_transcript = [](std::string const& path, std::vector<char> const& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    EXPECT_EQ(Cache::hash_source({}), 0UL);
+    EXPECT_EQ(Cache::hash_source(paths), 0UL);
+
+    // Larger than the samples at either end
+    std::vector<char> bytes(1 << 18, 1);
+    for (auto const& path : paths) {
+        write_transcript(path, bytes);
+    }
+    const uint64_t hash = Cache::hash_source(paths);
+    EXPECT_NE(hash, 0UL);
+    EXPECT_EQ(Cache::hash_source(paths), hash);
+    EXPECT_NE(Cache::hash_source({ paths[0] }), hash);
+
+    // Restores the contents and the modification time of the second transcript
+    const auto mtime = std::filesystem::last_write_time(paths[1]);
+    auto restore = [&]() {
+        write_transcript(paths[1], std::vector<char>(1 << 18, 1));
+        std::filesystem::last_write_time(paths[1], mtime);
+        EXPECT_EQ(Cache::hash_source(paths), hash);
+    };
+
+    // A different first or last point in a later transcript, or more points
+    bytes[100] = 2;
+    write_transcript(paths[1], bytes);
+    std::filesystem::last_write_time(paths[1], mtime);
+    EXPECT_NE(Cache::hash_source(paths), hash);
+    restore();
+    bytes[100] = 1;
+    bytes[bytes.size() - 100] = 2;
+    write_transcript(paths[1], bytes);
+    std::filesystem::last_write_time(paths[1], mtime);
+    EXPECT_NE(Cache::hash_source(paths), hash);
+    restore();
+    bytes[bytes.size() - 100] = 1;
+    bytes.resize(bytes.size() + 64, 1);
+    write_transcript(paths[1], bytes);
+    std::filesystem::last_write_time(paths[1], mtime);
+    EXPECT_NE(Cache::hash_source(paths), hash);
+    restore();
+
+    // The same contents, rewritten later
+    std::filesystem::last_write_time(paths[1], mtime + std::chrono::seconds(1));
+    EXPECT_NE(Cache::hash_source(paths), hash);
+
+    for (auto const& path : paths) {
+        std::filesystem::remove(path);
+    }
+}
+
+TEST(PointTableCacheTest, HeaderIsDeterministic)
+{
+    constexpr size_t num_points = 16;
+    auto points = random_points<curve::BN254>(num_points);
+    factories::MemProverCrs<curve::BN254> crs(points);
+    const std::vector<std::string> paths = { temp_path("_0.dat"), temp_path("_1.dat") };
+    auto read_file = [](std::string const& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+
+    for (auto const& path : paths) {
+        EXPECT_TRUE(PointTableCache<curve::BN254>::write(path, crs.get_monomial_points(), num_points, SOURCE_HASH));
+    }
+    EXPECT_EQ(read_file(paths[0]), read_file(paths[1]));
+    for (auto const& path : paths) {
+        std::filesystem::remove(path);
+    }
+}
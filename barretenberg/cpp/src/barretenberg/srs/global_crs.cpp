@@ -18,13 +18,21 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
     crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
 }
 
+// Initializes the crs using a point table that is already in pippenger form
+void init_crs_factory(std::shared_ptr<g1::affine_element[]> point_table,
+                      size_t num_points,
+                      g2::affine_element const g2_point)
+{
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(std::move(point_table), num_points, g2_point);
+}
+
 // Initializes crs from a file path this we use in the entire codebase
-void init_crs_factory(std::string crs_path)
+void init_crs_factory(std::string crs_path, bool use_point_table_cache)
 {
     if (crs_factory != nullptr) {
         return;
     }
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, use_point_table_cache);
 }
 
 // Initializes the crs using the memory buffers
@@ -33,12 +41,13 @@ void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const
     grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(points);
 }
 
-void init_grumpkin_crs_factory(std::string crs_path)
+void init_grumpkin_crs_factory(std::string crs_path, bool use_point_table_cache)
 {
     if (grumpkin_crs_factory != nullptr) {
         return;
     }
-    grumpkin_crs_factory = std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path);
+    grumpkin_crs_factory =
+        std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path, 0, use_point_table_cache);
 }
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_crs_factory()
@@ -1,16 +1,22 @@
+#pragma once
 #include "./factories/crs_factory.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
 namespace bb::srs {
 
-// Initializes the crs using files
-void init_crs_factory(std::string crs_path);
-void init_grumpkin_crs_factory(std::string crs_path);
+// Initializes the crs using files. If use_point_table_cache is set, the prover crs is memory mapped from a cached
+// pippenger point table in the crs directory, which is created on first use.
+void init_crs_factory(std::string crs_path, bool use_point_table_cache = false);
+void init_grumpkin_crs_factory(std::string crs_path, bool use_point_table_cache = false);
 
 // Initializes the crs using memory buffers
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
+// Initializes the crs from a point table already in pippenger form (see generate_pippenger_point_table), without copying
+void init_crs_factory(std::shared_ptr<bb::g1::affine_element[]> point_table,
+                      size_t num_points,
+                      bb::g2::affine_element const g2_point);
 
 std::shared_ptr<bb::srs::factories::CrsFactory<curve::BN254>> get_crs_factory();
 std::shared_ptr<bb::srs::factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <string>
 #include <sys/stat.h>
+#include <vector>
 
 namespace bb::srs {
 /**
@@ -136,11 +137,6 @@ template <typename Curve> class IO {
         file.close();
     }
 
-    static std::string get_transcript_path(std::string const& dir, size_t num)
-    {
-        return format(dir, "/monomial/transcript", (num < 10) ? "0" : "", std::to_string(num), ".dat");
-    };
-
     static bool is_file_exist(std::string const& fileName)
     {
         std::ifstream infile(fileName);
@@ -221,6 +217,20 @@ template <typename Curve> class IO {
     }
 
   public:
+    static std::string get_transcript_path(std::string const& dir, size_t num)
+    {
+        return format(dir, "/monomial/transcript", (num < 10) ? "0" : "", std::to_string(num), ".dat");
+    };
+
+    static std::vector<std::string> get_transcript_paths(std::string const& dir)
+    {
+        std::vector<std::string> paths;
+        while (is_file_exist(get_transcript_path(dir, paths.size()))) {
+            paths.push_back(get_transcript_path(dir, paths.size()));
+        }
+        return paths;
+    }
+
     template <typename AffineElementType> static void byteswap(AffineElementType* elements, size_t elements_size)
     {
         if constexpr (GivingG1AffineElementType<Curve, AffineElementType>) {
@@ -959,6 +959,64 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+/**
+ * @brief Check the sparse aware pippenger on each of its paths: small scalars, mostly zero full width scalars, dense
+ * scalars and all zero scalars
+ */
+TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeSparseAware)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<AffineElement> original_points(points.get(), points.get() + num_points);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    const auto check = [&](std::vector<Fr> scalars) {
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += original_points[i] * scalars[i];
+        }
+        Element result = scalar_multiplication::pippenger_unsafe_sparse_aware<Curve>(
+            scalars.data(), points.get(), num_points, state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    };
+
+    std::vector<Fr> scalars(num_points, 0);
+    // 0/1 scalars
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = engine.get_random_uint8() & 1;
+    }
+    check(scalars);
+    // Small scalars, including the largest value that fits in MAX_SMALL_SCALAR_BITS
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = engine.get_random_uint8();
+    }
+    scalars[7] = (1 << scalar_multiplication::MAX_SMALL_SCALAR_BITS) - 1;
+    check(scalars);
+    // Mostly zero full width scalars
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = (i % 5 == 0) ? Fr::random_element() : Fr(0);
+    }
+    check(scalars);
+    // Dense full width scalars
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+    }
+    check(scalars);
+    // All zero scalars
+    check(std::vector<Fr>(num_points, 0));
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
@@ -223,6 +223,49 @@ template <typename RecursiveFlavor> class ProtoGalaxyRecursiveTests : public tes
         }
     };
 
+    /**
+     * @brief Recursively verify the folding proof of NUM_INSTANCES instances folded at once, and ensure the recursive
+     * verifier agrees with the native one.
+     *
+     */
+    template <size_t NUM_INSTANCES> static void test_recursive_folding_multiple_instances()
+    {
+        using RecursiveVerifierInstances = ::bb::VerifierInstances_<RecursiveFlavor, NUM_INSTANCES>;
+        using RecursiveVerifier = ProtoGalaxyRecursiveVerifier_<RecursiveVerifierInstances>;
+
+        InnerComposer inner_composer = InnerComposer();
+        std::vector<std::shared_ptr<Instance>> instances;
+        for (size_t idx = 0; idx < NUM_INSTANCES; idx++) {
+            InnerBuilder builder;
+            create_inner_circuit(builder);
+            instances.emplace_back(inner_composer.create_instance(builder));
+        }
+
+        auto inner_folding_prover = inner_composer.template create_folding_prover<NUM_INSTANCES>(instances);
+        auto inner_folding_proof = inner_folding_prover.fold_instances();
+
+        OuterBuilder outer_folding_circuit;
+        RecursiveVerifier verifier{ &outer_folding_circuit };
+        verifier.verify_folding_proof(inner_folding_proof.folding_data);
+        info("Folding Recursive Verifier for ",
+             NUM_INSTANCES,
+             " instances: num gates = ",
+             outer_folding_circuit.num_gates);
+
+        auto native_folding_verifier = inner_composer.template create_folding_verifier<NUM_INSTANCES>();
+        auto native_folding_result = native_folding_verifier.verify_folding_proof(inner_folding_proof.folding_data);
+        EXPECT_TRUE(native_folding_result);
+        EXPECT_EQ(outer_folding_circuit.failed(), false) << outer_folding_circuit.err();
+
+        auto recursive_folding_manifest = verifier.transcript->get_manifest();
+        auto native_folding_manifest = native_folding_verifier.transcript->get_manifest();
+        for (size_t i = 0; i < recursive_folding_manifest.size(); ++i) {
+            EXPECT_EQ(recursive_folding_manifest[i], native_folding_manifest[i]);
+        }
+
+        EXPECT_TRUE(outer_folding_circuit.check_circuit());
+    };
+
     /**
      * @brief Perform two rounds of folding valid circuits and then recursive verify the final decider proof,
      * make sure the verifer circuits pass check_circuit(). Ensure that the algorithm of the recursive and native
@@ -387,6 +430,11 @@ TYPED_TEST(ProtoGalaxyRecursiveTests, RecursiveFoldingTest)
     TestFixture::test_recursive_folding();
 }
 
+TYPED_TEST(ProtoGalaxyRecursiveTests, RecursiveFoldingFourInstances)
+{
+    TestFixture::template test_recursive_folding_multiple_instances<4>();
+}
+
 TYPED_TEST(ProtoGalaxyRecursiveTests, FullProtogalaxyRecursiveTest)
 {
 
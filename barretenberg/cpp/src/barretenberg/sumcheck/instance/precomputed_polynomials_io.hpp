@@ -0,0 +1,84 @@
+#pragma once
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace bb {
+
+/**
+ * @brief Write the precomputed polynomials of a Honk proving key to dir, one file per polynomial
+ * @details The Honk counterpart of plonk::write_to_file. The key can be read back with read_precomputed_polynomials
+ * and passed to the ProverInstance_ constructor that skips circuit preprocessing.
+ *
+ * @param dir An existing directory
+ * @param key
+ * @param circuit_hash The hash of the circuit of the key, see ProverInstance_::compute_circuit_hash
+ */
+template <typename ProvingKey>
+void write_precomputed_polynomials(std::string const& dir, ProvingKey& key, uint64_t circuit_hash)
+{
+    std::ofstream os(dir + "/proving_key", std::ios::binary);
+    serialize::write(os, static_cast<uint64_t>(key.circuit_size));
+    serialize::write(os, static_cast<uint64_t>(key.num_public_inputs));
+    serialize::write(os, static_cast<uint64_t>(key.pub_inputs_offset));
+    serialize::write(os, circuit_hash);
+    if (!os.good()) {
+        throw_or_abort("Failed to write: " + dir + "/proving_key");
+    }
+
+    for (auto [poly, label] : zip_view(key.get_precomputed_polynomials(), key.get_precomputed_labels())) {
+        std::string const path = dir + "/" + label;
+        auto bytes = poly.byte_span();
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!ofs.good()) {
+            throw_or_abort("Failed to write: " + path);
+        }
+    }
+}
+
+/**
+ * @brief Read a proving key holding only the precomputed polynomials written by write_precomputed_polynomials
+ * @details The polynomials are memory mapped rather than read, see Polynomial::map_file.
+ *
+ * @param dir
+ * @return std::shared_ptr<ProvingKey> A key whose witness polynomials are empty
+ */
+template <typename ProvingKey> std::shared_ptr<ProvingKey> read_precomputed_polynomials(std::string const& dir)
+{
+    using Polynomial = typename ProvingKey::Polynomial;
+
+    std::ifstream is(dir + "/proving_key", std::ios::binary);
+    if (!is) {
+        throw_or_abort("Failed to open file: " + dir + "/proving_key");
+    }
+    uint64_t circuit_size = 0;
+    uint64_t num_public_inputs = 0;
+    uint64_t pub_inputs_offset = 0;
+    uint64_t circuit_hash = 0;
+    serialize::read(is, circuit_size);
+    serialize::read(is, num_public_inputs);
+    serialize::read(is, pub_inputs_offset);
+    serialize::read(is, circuit_hash);
+    if (!is) {
+        throw_or_abort("Failed to read: " + dir + "/proving_key");
+    }
+
+    auto key = std::make_shared<ProvingKey>();
+    key->circuit_size = circuit_size;
+    key->log_circuit_size = numeric::get_msb(circuit_size);
+    key->num_public_inputs = num_public_inputs;
+    key->pub_inputs_offset = pub_inputs_offset;
+    key->circuit_hash = circuit_hash;
+    for (auto [poly, label] : zip_view(key->get_precomputed_polynomials(), key->get_precomputed_labels())) {
+        poly = Polynomial::map_file(dir + "/" + label);
+    }
+    return key;
+}
+
+} // namespace bb
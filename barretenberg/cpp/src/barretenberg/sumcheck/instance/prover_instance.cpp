@@ -32,6 +32,99 @@ template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circ
     return circuit.get_circuit_subgroup_size(total_num_gates);
 }
 
+/**
+ * @brief Compute the row of the first public input, after the zero row and the ecc op gates
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <class Flavor> size_t ProverInstance_<Flavor>::compute_pub_inputs_offset(Circuit& circuit)
+{
+    size_t offset = num_zero_rows;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        offset += circuit.num_ecc_op_gates;
+    }
+    return offset;
+}
+
+/**
+ * @brief Hash everything about the circuit the precomputed polynomials depend on, i.e. the public inputs, the
+ * selectors, the copy constraints and tags of the wires and the lookup tables, but not the witness
+ * @details Used to check that precomputed polynomials are only reused for a circuit of the same structure. It costs a
+ * pass over every gate, so it is only computed for keys that are written or reused.
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <class Flavor> uint64_t ProverInstance_<Flavor>::compute_circuit_hash(const Circuit& circuit)
+{
+    // The hash_combine of boost, see the hash of cached_partial_non_native_field_multiplication
+    uint64_t hash = 0;
+    const auto combine = [&hash](uint64_t value) { hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+    const auto combine_wires = [&](const auto& wires) {
+        for (const auto& wire : wires) {
+            combine(wire.size());
+            for (const uint32_t var_idx : wire) {
+                const uint32_t real_var_idx = circuit.real_variable_index[var_idx];
+                combine(real_var_idx);
+                combine(circuit.real_variable_tags[real_var_idx]);
+            }
+        }
+    };
+
+    // The public inputs are copied into the wires of their block, so which variables they are matters too
+    combine(circuit.public_inputs.size());
+    for (const uint32_t var_idx : circuit.public_inputs) {
+        combine(circuit.real_variable_index[var_idx]);
+    }
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        combine(circuit.num_ecc_op_gates);
+        combine_wires(circuit.ecc_op_block.wires);
+    }
+    combine_wires(circuit.wires);
+    for (const auto& selector : circuit.selectors.get()) {
+        for (const auto& value : selector) {
+            for (const uint64_t limb : value.data) {
+                combine(limb);
+            }
+        }
+    }
+    for (const auto& [tag, tau_tag] : circuit.tau) {
+        combine(tag);
+        combine(tau_tag);
+    }
+    for (const auto& table : circuit.lookup_tables) {
+        combine(static_cast<uint64_t>(table.id));
+        combine(table.size);
+    }
+    return hash;
+}
+
+/**
+ * @brief Construct the polynomials and proving key data that depend on the witness, or are cheap enough to derive from
+ * the circuit that they are not worth caching
+ *
+ * @tparam Flavor
+ * @param circuit
+ */
+template <class Flavor> void ProverInstance_<Flavor>::construct_witness_dependent_data(Circuit& circuit)
+{
+    // If Goblin, construct the ECC op queue wire and databus polynomials
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/862): Maybe do this in trace generation?
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        construct_ecc_op_wire_polynomials(circuit);
+        construct_databus_polynomials(circuit);
+    }
+
+    proving_key->recursive_proof_public_input_indices = std::vector<uint32_t>(
+        recursive_proof_public_input_indices.begin(), recursive_proof_public_input_indices.end());
+    proving_key->contains_recursive_proof = contains_recursive_proof;
+
+    sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit, dyadic_circuit_size);
+
+    populate_memory_read_write_records<Flavor>(circuit, proving_key);
+}
+
 /**
  * @brief Construct Goblin style ECC op wire polynomials
  * @details The Ecc op wire values are assumed to have already been stored in the corresponding block of the
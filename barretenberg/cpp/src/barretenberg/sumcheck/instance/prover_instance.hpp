@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
@@ -67,33 +68,59 @@ template <class Flavor> class ProverInstance_ {
         dyadic_circuit_size = compute_dyadic_size(circuit);
 
         proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, circuit.public_inputs.size());
+        proving_key->pub_inputs_offset = compute_pub_inputs_offset(circuit);
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         Trace::generate(circuit, proving_key);
 
-        // If Goblin, construct the ECC op queue wire and databus polynomials
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/862): Maybe do this in trace generation?
-        if constexpr (IsGoblinFlavor<Flavor>) {
-            construct_ecc_op_wire_polynomials(circuit);
-            construct_databus_polynomials(circuit);
-        }
-
         compute_first_and_last_lagrange_polynomials<Flavor>(proving_key.get());
 
         construct_table_polynomials(circuit, dyadic_circuit_size);
 
-        proving_key->recursive_proof_public_input_indices = std::vector<uint32_t>(
-            recursive_proof_public_input_indices.begin(), recursive_proof_public_input_indices.end());
-        proving_key->contains_recursive_proof = contains_recursive_proof;
+        construct_witness_dependent_data(circuit);
+    }
+
+    /**
+     * @brief Construct an instance reusing the precomputed polynomials of a key for a circuit of the same structure
+     * @details The precomputed polynomials (selectors, sigma/id, tables, lagrange) of precomputed_key are shared rather
+     * than recomputed, so only the witness-dependent polynomials of the circuit are constructed. The key may come from
+     * an earlier instance, whose circuit_hash has to be set with compute_circuit_hash, or from
+     * read_precomputed_polynomials. The circuit must have the same size, public inputs and structure (selectors, copy
+     * constraints and lookup tables) as the circuit of the key.
+     */
+    ProverInstance_(Circuit& circuit, ProvingKey& precomputed_key)
+    {
+        if (precomputed_key.circuit_hash == 0) {
+            throw_or_abort("Precomputed polynomials can only be reused with the hash of their circuit.");
+        }
+        dyadic_circuit_size = compute_dyadic_size(circuit);
+        const size_t circuit_pub_inputs_offset = compute_pub_inputs_offset(circuit);
+        const uint64_t circuit_hash = compute_circuit_hash(circuit);
+        if (dyadic_circuit_size != precomputed_key.circuit_size ||
+            circuit.public_inputs.size() != precomputed_key.num_public_inputs ||
+            circuit_pub_inputs_offset != precomputed_key.pub_inputs_offset ||
+            circuit_hash != precomputed_key.circuit_hash) {
+            throw_or_abort("Precomputed polynomials were computed for a different circuit.");
+        }
+
+        proving_key = std::make_shared<ProvingKey>(dyadic_circuit_size, circuit.public_inputs.size());
+        proving_key->pub_inputs_offset = circuit_pub_inputs_offset;
+        proving_key->circuit_hash = circuit_hash;
+        for (auto [poly, precomputed_poly] :
+             zip_view(proving_key->get_precomputed_polynomials(), precomputed_key.get_precomputed_polynomials())) {
+            poly = precomputed_poly.share();
+        }
 
-        sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit, dyadic_circuit_size);
+        Trace::generate_wires(circuit, proving_key);
 
-        populate_memory_read_write_records<Flavor>(circuit, proving_key);
+        construct_witness_dependent_data(circuit);
     }
 
     ProverInstance_() = default;
     ~ProverInstance_() = default;
 
+    static uint64_t compute_circuit_hash(const Circuit&);
+
     void initialize_prover_polynomials();
 
     void compute_sorted_accumulator_polynomials(FF);
@@ -116,6 +143,10 @@ template <class Flavor> class ProverInstance_ {
 
     size_t compute_dyadic_size(Circuit&);
 
+    static size_t compute_pub_inputs_offset(Circuit&);
+
+    void construct_witness_dependent_data(Circuit&);
+
     void construct_ecc_op_wire_polynomials(Circuit&)
         requires IsGoblinFlavor<Flavor>;
 
@@ -95,22 +95,35 @@ template <typename Flavor> class SumcheckProver {
         multivariate_challenge.reserve(multivariate_d);
 
         // First round
-        // This populates partially_evaluated_polynomials.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
-        // We operate on partially_evaluated_polynomials in place.
+        round.round_size = round.round_size >> 1;
+
+        // All but final round
+        // The partial evaluation of the full polynomials at u_0, which populates partially_evaluated_polynomials, is
+        // done in the same pass as the computation of the second round univariate. From then on, we operate on
+        // partially_evaluated_polynomials in place.
+        if (multivariate_d == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
-            round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
+            if (round_idx == 1) {
+                round_univariate = round.fold_and_compute_univariate(full_polynomials,
+                                                                     round_challenge,
+                                                                     partially_evaluated_polynomials,
+                                                                     relation_parameters,
+                                                                     pow_univariate,
+                                                                     alpha);
+            } else {
+                round_univariate = round.compute_univariate(
+                    partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
+            }
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
             partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
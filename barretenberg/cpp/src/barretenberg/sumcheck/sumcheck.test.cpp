@@ -122,6 +122,64 @@ TEST_F(SumcheckTests, PolynomialNormalization)
     }
 }
 
+TEST_F(SumcheckTests, FoldAndComputeUnivariate)
+{
+    // Large enough for the second round to be spread over several threads
+    const size_t multivariate_d(10);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::array<Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (auto& poly : random_polynomials) {
+        poly = random_poly(multivariate_n);
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+    RelationSeparator alpha;
+    for (auto& challenge : alpha) {
+        challenge = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(multivariate_d);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element();
+    }
+    bb::RelationParameters<FF> relation_parameters;
+    relation_parameters.eta = FF::random_element();
+    relation_parameters.beta = FF::random_element();
+    relation_parameters.gamma = FF::random_element();
+    relation_parameters.public_input_delta = FF::random_element();
+    relation_parameters.lookup_grand_product_delta = FF::random_element();
+    bb::PowPolynomial<FF> pow_polynomial(gate_challenges);
+    pow_polynomial.compute_values();
+    const FF round_challenge = FF::random_element();
+    pow_polynomial.partially_evaluate(round_challenge);
+
+    // Partially evaluate the full polynomials, then compute the second round univariate from the result
+    auto transcript = Flavor::Transcript::prover_init_empty();
+    auto separate = SumcheckProver<Flavor>(multivariate_n, transcript);
+    separate.partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+    separate.round.round_size = multivariate_n >> 1;
+    auto expected_univariate = separate.round.compute_univariate(
+        separate.partially_evaluated_polynomials, relation_parameters, pow_polynomial, alpha);
+
+    // Do both in a single pass
+    auto fused = SumcheckProver<Flavor>(multivariate_n, transcript);
+    fused.round.round_size = multivariate_n >> 1;
+    auto univariate = fused.round.fold_and_compute_univariate(full_polynomials,
+                                                              round_challenge,
+                                                              fused.partially_evaluated_polynomials,
+                                                              relation_parameters,
+                                                              pow_polynomial,
+                                                              alpha);
+
+    EXPECT_EQ(univariate, expected_univariate);
+    for (auto [poly, expected_poly] :
+         zip_view(fused.partially_evaluated_polynomials.get_all(), separate.partially_evaluated_polynomials.get_all())) {
+        for (size_t i = 0; i < multivariate_n >> 1; ++i) {
+            EXPECT_EQ(poly[i], expected_poly[i]);
+        }
+    }
+}
+
 TEST_F(SumcheckTests, Prover)
 {
     const size_t multivariate_d(2);
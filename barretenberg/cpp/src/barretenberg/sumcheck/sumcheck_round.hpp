@@ -106,58 +106,55 @@ template <typename Flavor> class SumcheckProverRound {
         const bb::PowPolynomial<FF>& pow_polynomial,
         const RelationSeparator alpha)
     {
-        // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
-        // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
-        // previous rounds) and the elements of pow(\vec{β}) not containing β_0,..., β_l.
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_polynomial.partial_evaluation_result;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
-        }
-
-        // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
-
-        // Construct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            Utils::zero_univariates(accum);
-        }
-
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
-        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the i-th edge's univariate contribution,
-                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenges[edge_idx >> 1]);
-            }
-        });
-
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
-        }
+        return accumulate_over_edges(
+            [&](ExtendedEdges& extended_edges, size_t edge_idx) { extend_edges(extended_edges, polynomials, edge_idx); },
+            relation_parameters,
+            pow_polynomial,
+            alpha);
+    }
 
-        // Batch the univariate contributions from each sub-relation to obtain the round univariate
-        return batch_over_relations<bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
-            univariate_accumulators, alpha, pow_polynomial);
+    /**
+     * @brief Partially evaluate the polynomials of the previous round at its challenge and compute the univariate of
+     * this round in the same pass.
+     *
+     * @details The edge (2i, 2i+1) of this round is obtained by folding the entries 4i, ..., 4i+3 of the previous
+     * round's polynomials, so each thread can fold the part of the source covering its own edges, write the result to
+     * `folded` and extend it straight away. Compared to partially evaluating and then calling compute_univariate, this
+     * saves a full read of the folded polynomials. The source and destination must not alias, as threads would
+     * otherwise overwrite entries still to be read by their neighbours; in practice this is used for the first fold,
+     * from the full ProverPolynomials into the half-size PartiallyEvaluatedMultivariates.
+     *
+     * @param previous_polynomials The polynomials of the previous round, of size 2 * round_size
+     * @param previous_challenge The challenge of the previous round
+     * @param folded Destination of the partial evaluation, of size at least round_size
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PartiallyEvaluatedMultivariates>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> fold_and_compute_univariate(
+        const ProverPolynomialsOrPartiallyEvaluatedMultivariates& previous_polynomials,
+        const FF& previous_challenge,
+        PartiallyEvaluatedMultivariates& folded,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
+        auto previous_view = previous_polynomials.get_all();
+        auto folded_view = folded.get_all();
+        return accumulate_over_edges(
+            [&](ExtendedEdges& extended_edges, size_t edge_idx) {
+                for (auto [extended_edge, previous, target] :
+                     zip_view(extended_edges.get_all(), previous_view, folded_view)) {
+                    const size_t idx = edge_idx << 1;
+                    FF value_0 = previous[idx] + previous_challenge * (previous[idx + 1] - previous[idx]);
+                    FF value_1 = previous[idx + 2] + previous_challenge * (previous[idx + 3] - previous[idx + 2]);
+                    target[edge_idx] = value_0;
+                    target[edge_idx + 1] = value_1;
+                    bb::Univariate<FF, 2> edge({ value_0, value_1 });
+                    extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+                }
+            },
+            relation_parameters,
+            pow_polynomial,
+            alpha);
     }
 
     /**
@@ -217,6 +214,71 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Accumulate the relation contributions over all edges of the round, with `extend` filling in the extended
+     * edges for a given edge index, and batch them into the round univariate.
+     */
+    template <typename ExtendEdgesFn>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> accumulate_over_edges(
+        ExtendEdgesFn&& extend,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
+        // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
+        // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
+        // previous rounds) and the elements of pow(\vec{β}) not containing β_0,..., β_l.
+        std::vector<FF> pow_challenges(round_size >> 1);
+        pow_challenges[0] = pow_polynomial.partial_evaluation_result;
+        for (size_t i = 1; i < (round_size >> 1); ++i) {
+            pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
+        }
+
+        // Determine number of threads for multithreading.
+        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
+        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
+        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+
+        // Construct univariate accumulator containers; one per thread
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        for (auto& accum : thread_univariate_accumulators) {
+            Utils::zero_univariates(accum);
+        }
+
+        // Construct extended edge containers; one per thread
+        std::vector<ExtendedEdges> extended_edges;
+        extended_edges.resize(num_threads);
+
+        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            size_t start = thread_idx * iterations_per_thread;
+            size_t end = (thread_idx + 1) * iterations_per_thread;
+
+            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                extend(extended_edges[thread_idx], edge_idx);
+
+                // Compute the i-th edge's univariate contribution,
+                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
+                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                extended_edges[thread_idx],
+                                                relation_parameters,
+                                                pow_challenges[edge_idx >> 1]);
+            }
+        });
+
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        return batch_over_relations<bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
+            univariate_accumulators, alpha, pow_polynomial);
+    }
+
     /**
      * @brief For a given edge, calculate the contribution of each relation to the prover round univariate (S_l in the
      * thesis).
@@ -226,7 +288,8 @@ template <typename Flavor> class SumcheckProverRound {
      *                 every other point. On each iteration, create a Univariate<FF, 2> (an 'edge') for each
      *                 multivariate.
      *   - Inner loop: iterate through the relations, feeding each relation the present collection of edges. Each
-     *                 relation adds a contribution
+     *                 relation adds a contribution, unless it is skippable (see isSkippable) and vanishes on the
+     *                 present edges.
      *
      * Result: for each relation, a univariate of some degree is computed by accumulating the contributions of each
      * group of edges. These are stored in `univariate_accumulators`. Adding these univariates together, with
@@ -239,8 +302,18 @@ template <typename Flavor> class SumcheckProverRound {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        // Relations gated by a selector contribute nothing on edges where the selector vanishes at both vertices
+        if constexpr (isSkippable<Relation, decltype(extended_edges)>) {
+            if (!Relation::skip(extended_edges)) {
+                Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                     extended_edges,
+                                     relation_parameters,
+                                     scaling_factor);
+            }
+        } else {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
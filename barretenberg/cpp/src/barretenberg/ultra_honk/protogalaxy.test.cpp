@@ -323,6 +323,41 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         decide_and_verify(second_accumulator, composer, true);
     }
 
+    /**
+     * @brief Fold NUM_INSTANCES fresh instances at once, then fold the resulting accumulator with NUM_INSTANCES - 1
+     * more, and check that the final accumulator is accepted by the decider.
+     */
+    template <size_t NUM_INSTANCES> static void test_full_protogalaxy_multiple_instances()
+    {
+        auto composer = Composer();
+        const auto construct_instances = [&](size_t num_instances) {
+            std::vector<std::shared_ptr<Instance>> instances;
+            for (size_t idx = 0; idx < num_instances; idx++) {
+                auto builder = typename Flavor::CircuitBuilder();
+                construct_circuit(builder);
+                instances.emplace_back(composer.create_instance(builder));
+            }
+            return instances;
+        };
+        const auto fold_and_verify = [&](const std::vector<std::shared_ptr<Instance>>& instances) {
+            auto folding_prover = composer.template create_folding_prover<NUM_INSTANCES>(instances);
+            auto folding_verifier = composer.template create_folding_verifier<NUM_INSTANCES>();
+            auto proof = folding_prover.fold_instances();
+            EXPECT_TRUE(folding_verifier.verify_folding_proof(proof.folding_data));
+            return proof.accumulator;
+        };
+
+        auto first_accumulator = fold_and_verify(construct_instances(NUM_INSTANCES));
+        check_accumulator_target_sum_manual(first_accumulator, true);
+
+        auto instances = construct_instances(NUM_INSTANCES - 1);
+        instances.insert(instances.begin(), first_accumulator);
+        auto second_accumulator = fold_and_verify(instances);
+        check_accumulator_target_sum_manual(second_accumulator, true);
+
+        decide_and_verify(second_accumulator, composer, true);
+    }
+
     /**
      * @brief Ensure tampering a commitment and then calling the decider causes the decider verification to fail.
      *
@@ -433,6 +468,21 @@ TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyTest)
     TestFixture::test_full_protogalaxy();
 }
 
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyFourInstances)
+{
+    TestFixture::template test_full_protogalaxy_multiple_instances<4>();
+}
+
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyEightInstances)
+{
+    TestFixture::template test_full_protogalaxy_multiple_instances<8>();
+}
+
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxySixteenInstances)
+{
+    TestFixture::template test_full_protogalaxy_multiple_instances<16>();
+}
+
 TYPED_TEST(ProtoGalaxyTests, TamperedCommitment)
 {
     TestFixture::test_tampered_commitment();
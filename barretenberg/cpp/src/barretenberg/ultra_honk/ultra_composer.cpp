@@ -76,6 +76,26 @@ std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_instance
     return instance;
 }
 
+/**
+ * @brief Create an instance whose precomputed polynomials are shared with precomputed_key, computed earlier for a
+ * circuit of the same structure or read from disk with read_precomputed_polynomials
+ * @details The verification key only depends on the precomputed polynomials, so one computed earlier can be passed in
+ * to skip committing to them again.
+ */
+template <IsUltraFlavor Flavor>
+std::shared_ptr<ProverInstance_<Flavor>> UltraComposer_<Flavor>::create_instance(
+    CircuitBuilder& circuit, ProvingKey& precomputed_key, std::shared_ptr<VerificationKey> verification_key)
+{
+    circuit.add_gates_to_ensure_all_polys_are_non_zero();
+    circuit.finalize_circuit();
+    auto instance = std::make_shared<Instance>(circuit, precomputed_key);
+    commitment_key = compute_commitment_key(instance->proving_key->circuit_size);
+
+    instance->verification_key = std::move(verification_key);
+    compute_verification_key(instance);
+    return instance;
+}
+
 template <IsUltraFlavor Flavor>
 UltraProver_<Flavor> UltraComposer_<Flavor>::create_prover(const std::shared_ptr<Instance>& instance,
                                                            const std::shared_ptr<Transcript>& transcript)
@@ -59,6 +59,9 @@ template <IsUltraFlavor Flavor_> class UltraComposer_ {
     };
 
     std::shared_ptr<Instance> create_instance(CircuitBuilder& circuit);
+    std::shared_ptr<Instance> create_instance(CircuitBuilder& circuit,
+                                              ProvingKey& precomputed_key,
+                                              std::shared_ptr<VerificationKey> verification_key = nullptr);
 
     UltraProver_<Flavor> create_prover(const std::shared_ptr<Instance>&,
                                        const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
@@ -82,17 +85,23 @@ template <IsUltraFlavor Flavor_> class UltraComposer_ {
 
     UltraVerifier_<Flavor> create_ultra_with_keccak_verifier(CircuitBuilder& circuit);
 
-    ProtoGalaxyProver_<ProverInstances> create_folding_prover(const std::vector<std::shared_ptr<Instance>>& instances)
+    /**
+     * @brief Create a prover folding NUM_INSTANCES instances, the first of which may be an accumulator
+     */
+    template <size_t NUM_INSTANCES = NUM_FOLDING>
+    ProtoGalaxyProver_<ProverInstances_<Flavor, NUM_INSTANCES>> create_folding_prover(
+        const std::vector<std::shared_ptr<Instance>>& instances)
     {
-        ProtoGalaxyProver_<ProverInstances> output_state(instances, commitment_key);
+        ProtoGalaxyProver_<ProverInstances_<Flavor, NUM_INSTANCES>> output_state(instances, commitment_key);
 
         return output_state;
     };
-    ProtoGalaxyVerifier_<VerifierInstances> create_folding_verifier()
+    template <size_t NUM_INSTANCES = NUM_FOLDING>
+    ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM_INSTANCES>> create_folding_verifier()
     {
 
-        auto insts = VerifierInstances();
-        ProtoGalaxyVerifier_<VerifierInstances> output_state(insts);
+        auto insts = VerifierInstances_<Flavor, NUM_INSTANCES>();
+        ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM_INSTANCES>> output_state(insts);
 
         return output_state;
     };
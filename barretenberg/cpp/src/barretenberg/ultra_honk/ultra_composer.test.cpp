@@ -8,12 +8,15 @@
 #include "barretenberg/proof_system/plookup_tables/types.hpp"
 #include "barretenberg/relations/permutation_relation.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/sumcheck/instance/precomputed_polynomials_io.hpp"
 #include "barretenberg/sumcheck/sumcheck_round.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <string>
+#include <unistd.h>
 #include <vector>
 
 using namespace bb;
@@ -141,6 +144,105 @@ TEST_F(UltraHonkComposerTests, XorConstraint)
     prove_and_verify(circuit_builder, composer, /*expected_result=*/true);
 }
 
+/**
+ * @brief Check that precomputed polynomials written to disk can be reused to prove a new witness for the same circuit
+ *
+ */
+TEST_F(UltraHonkComposerTests, ProveWithPrecomputedPolynomialsFromDisk)
+{
+    // Circuits of identical structure that differ only in their witness
+    auto create_circuit = [](uint32_t left_value, uint32_t right_value) {
+        auto circuit_builder = UltraCircuitBuilder();
+        fr left_witness_value = fr{ left_value, 0, 0, 0 }.to_montgomery_form();
+        fr right_witness_value = fr{ right_value, 0, 0, 0 }.to_montgomery_form();
+        uint32_t left_witness_index = circuit_builder.add_public_variable(left_witness_value);
+        uint32_t right_witness_index = circuit_builder.add_variable(right_witness_value);
+        const auto lookup_accumulators = plookup::get_lookup_accumulators(
+            plookup::MultiTableId::UINT32_XOR, left_witness_value, right_witness_value, true);
+        circuit_builder.create_gates_from_plookup_accumulators(
+            plookup::MultiTableId::UINT32_XOR, lookup_accumulators, left_witness_index, right_witness_index);
+        return circuit_builder;
+    };
+    // Unique per process so that concurrent runs of the test do not share the key
+    const std::string key_dir = (std::filesystem::temp_directory_path() /
+                                 ("bb_" + std::to_string(getpid()) + "_" +
+                                  ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+                                    .string();
+    std::filesystem::create_directories(key_dir);
+
+    auto first_circuit = create_circuit(engine.get_random_uint32(), engine.get_random_uint32());
+    auto composer = UltraComposer();
+    auto first_instance = composer.create_instance(first_circuit);
+    write_precomputed_polynomials(
+        key_dir, *first_instance->proving_key, ProverInstance_<UltraFlavor>::compute_circuit_hash(first_circuit));
+
+    auto precomputed_key = read_precomputed_polynomials<UltraFlavor::ProvingKey>(key_dir);
+    for (auto [poly, expected] : zip_view(precomputed_key->get_precomputed_polynomials(),
+                                          first_instance->proving_key->get_precomputed_polynomials())) {
+        EXPECT_EQ(poly, expected);
+    }
+
+    auto second_circuit = create_circuit(engine.get_random_uint32(), engine.get_random_uint32());
+    auto second_instance = composer.create_instance(second_circuit, *precomputed_key);
+
+    // The proof must verify against the verification key of the original circuit
+    auto prover = composer.create_prover(second_instance);
+    auto verifier = composer.create_verifier(first_instance);
+    auto proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    std::filesystem::remove_all(key_dir);
+}
+
+/**
+ * @brief Check that precomputed polynomials are not reused for a circuit of the same size but a different structure
+ *
+ */
+TEST_F(UltraHonkComposerTests, PrecomputedPolynomialsOfDifferentCircuitAreRejected)
+{
+    enum class PublicValue { NONE, LEFT, RIGHT };
+    auto create_circuit = [](PublicValue public_value) {
+        auto circuit_builder = UltraCircuitBuilder();
+        fr left_value = fr::random_element();
+        fr right_value = fr::random_element();
+        uint32_t left_idx = circuit_builder.add_variable(left_value);
+        uint32_t right_idx = circuit_builder.add_variable(right_value);
+        uint32_t sum_idx = circuit_builder.add_variable(left_value + right_value);
+        if (public_value == PublicValue::LEFT) {
+            circuit_builder.set_public_input(left_idx);
+        } else if (public_value == PublicValue::RIGHT) {
+            circuit_builder.set_public_input(right_idx);
+        }
+        circuit_builder.create_add_gate({ left_idx, right_idx, sum_idx, fr(1), fr(1), fr(-1), fr(0) });
+        return circuit_builder;
+    };
+    auto composer = UltraComposer();
+    auto circuit = create_circuit(PublicValue::LEFT);
+    auto instance = composer.create_instance(circuit);
+
+    // The key of an instance can only be reused once the hash of its circuit is set
+    auto same_circuit = create_circuit(PublicValue::LEFT);
+    EXPECT_ANY_THROW(composer.create_instance(same_circuit, *instance->proving_key));
+    instance->proving_key->circuit_hash = ProverInstance_<UltraFlavor>::compute_circuit_hash(circuit);
+
+    // Same structure: the key is reused
+    same_circuit = create_circuit(PublicValue::LEFT);
+    EXPECT_NO_THROW(composer.create_instance(same_circuit, *instance->proving_key));
+
+    // Same dyadic size, but no public input
+    auto private_circuit = create_circuit(PublicValue::NONE);
+    EXPECT_ANY_THROW(composer.create_instance(private_circuit, *instance->proving_key));
+
+    // Same number of public inputs, but another variable is public
+    auto other_public_circuit = create_circuit(PublicValue::RIGHT);
+    EXPECT_ANY_THROW(composer.create_instance(other_public_circuit, *instance->proving_key));
+
+    // Same size and public inputs, but a different copy constraint
+    auto rewired_circuit = create_circuit(PublicValue::LEFT);
+    rewired_circuit.assert_equal(rewired_circuit.public_inputs[0], rewired_circuit.zero_idx);
+    EXPECT_ANY_THROW(composer.create_instance(rewired_circuit, *instance->proving_key));
+}
+
 TEST_F(UltraHonkComposerTests, create_gates_from_plookup_accumulators)
 {
     auto circuit_builder = UltraCircuitBuilder();
@@ -53,9 +53,11 @@ template <IsUltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitme
 
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(proving_key->w_l);
-    witness_commitments.w_r = commitment_key->commit(proving_key->w_r);
-    witness_commitments.w_o = commitment_key->commit(proving_key->w_o);
+    std::array<std::span<const FF>, 3> wires{ proving_key->w_l, proving_key->w_r, proving_key->w_o };
+    auto wire_commitments = commitment_key->commit_batch(wires);
+    witness_commitments.w_l = wire_commitments[0];
+    witness_commitments.w_r = wire_commitments[1];
+    witness_commitments.w_o = wire_commitments[2];
 
     auto wire_comms = witness_commitments.get_wires();
     auto labels = commitment_labels.get_wires();
@@ -64,11 +66,18 @@ template <IsUltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitme
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(proving_key->ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(proving_key->ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(proving_key->ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(proving_key->ecc_op_wire_4);
+        // Commit to Goblin ECC op wires and DataBus columns in a single batch
+        std::array<std::span<const FF>, 6> goblin_polynomials{
+            proving_key->ecc_op_wire_1, proving_key->ecc_op_wire_2, proving_key->ecc_op_wire_3,
+            proving_key->ecc_op_wire_4, proving_key->calldata,      proving_key->calldata_read_counts
+        };
+        auto goblin_commitments = commitment_key->commit_batch(goblin_polynomials);
+        witness_commitments.ecc_op_wire_1 = goblin_commitments[0];
+        witness_commitments.ecc_op_wire_2 = goblin_commitments[1];
+        witness_commitments.ecc_op_wire_3 = goblin_commitments[2];
+        witness_commitments.ecc_op_wire_4 = goblin_commitments[3];
+        witness_commitments.calldata = goblin_commitments[4];
+        witness_commitments.calldata_read_counts = goblin_commitments[5];
 
         auto op_wire_comms = instance->witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
@@ -76,9 +85,6 @@ template <IsUltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitme
             transcript->send_to_verifier(labels[idx], op_wire_comms[idx]);
         }
 
-        // Commit to DataBus columns
-        witness_commitments.calldata = commitment_key->commit(proving_key->calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(proving_key->calldata_read_counts);
         transcript->send_to_verifier(commitment_labels.calldata, instance->witness_commitments.calldata);
         transcript->send_to_verifier(commitment_labels.calldata_read_counts,
                                      instance->witness_commitments.calldata_read_counts);
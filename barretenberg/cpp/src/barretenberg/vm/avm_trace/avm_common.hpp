@@ -8,7 +8,9 @@ namespace bb::avm_trace {
 
 using Flavor = bb::AvmFlavor;
 using FF = Flavor::FF;
-using Row = bb::AvmFullRow<bb::fr>;
+// The trace is written column by column, a row is only read back from the columns
+using TraceColumns = Flavor::ProverPolynomials;
+using Row = Flavor::AllValues;
 
 // Number of rows
 static const size_t AVM_TRACE_SIZE = 256;
@@ -43,9 +43,9 @@ HonkProof Execution::run_and_prove(std::vector<uint8_t> const& bytecode, std::ve
  *
  * @param instructions A vector of the instructions to be executed.
  * @param calldata expressed as a vector of finite field elements.
- * @return The trace as a vector of Row.
+ * @return The columns of the trace.
  */
-std::vector<Row> Execution::gen_trace(std::vector<Instruction> const& instructions, std::vector<FF> const& calldata)
+TraceColumns Execution::gen_trace(std::vector<Instruction> const& instructions, std::vector<FF> const& calldata)
 {
     AvmTraceBuilder trace_builder;
 
@@ -14,8 +14,8 @@ class Execution {
   public:
     Execution() = default;
 
-    static std::vector<Row> gen_trace(std::vector<Instruction> const& instructions,
-                                      std::vector<FF> const& calldata = {});
+    static TraceColumns gen_trace(std::vector<Instruction> const& instructions,
+                                  std::vector<FF> const& calldata = {});
     static bb::HonkProof run_and_prove(std::vector<uint8_t> const& bytecode, std::vector<FF> const& calldata = {});
 };
 
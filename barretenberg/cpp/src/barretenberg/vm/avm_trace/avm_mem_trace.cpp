@@ -1,6 +1,8 @@
 #include "avm_mem_trace.hpp"
 #include "barretenberg/vm/avm_trace/avm_common.hpp"
 
+#include <algorithm>
+
 namespace bb::avm_trace {
 
 /**
@@ -29,9 +31,31 @@ void AvmMemTraceBuilder::reset()
  */
 std::vector<AvmMemTraceBuilder::MemoryTraceEntry> AvmMemTraceBuilder::finalize()
 {
-    // Sort avm_mem
-    std::sort(mem_trace.begin(), mem_trace.end());
-    return std::move(mem_trace);
+    // Sort avm_mem by (address, clk, sub_clk). Entries are inserted in (clk, sub_clk) order, so a stable counting
+    // sort by address over the MEM_SIZE cells suffices and avoids the comparison sort.
+    auto clk_order = [](MemoryTraceEntry const& a, MemoryTraceEntry const& b) {
+        return a.m_clk < b.m_clk || (a.m_clk == b.m_clk && a.m_sub_clk < b.m_sub_clk);
+    };
+    bool addr_in_range = std::all_of(
+        mem_trace.begin(), mem_trace.end(), [](MemoryTraceEntry const& e) { return e.m_addr < MEM_SIZE; });
+    if (!addr_in_range || !std::is_sorted(mem_trace.begin(), mem_trace.end(), clk_order)) {
+        std::sort(mem_trace.begin(), mem_trace.end());
+        return std::move(mem_trace);
+    }
+
+    std::vector<size_t> offsets(MEM_SIZE + 1, 0);
+    for (auto const& entry : mem_trace) {
+        offsets[entry.m_addr + 1]++;
+    }
+    for (size_t addr = 0; addr < MEM_SIZE; addr++) {
+        offsets[addr + 1] += offsets[addr];
+    }
+    std::vector<MemoryTraceEntry> sorted_trace(mem_trace.size());
+    for (auto const& entry : mem_trace) {
+        sorted_trace[offsets[entry.m_addr]++] = entry;
+    }
+    mem_trace.clear();
+    return sorted_trace;
 }
 
 /**
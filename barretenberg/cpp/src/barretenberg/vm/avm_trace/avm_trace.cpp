@@ -1,5 +1,4 @@
 #include <array>
-#include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
@@ -9,16 +8,17 @@
 #include <vector>
 
 #include "avm_trace.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::avm_trace {
 
 /**
- * @brief Constructor of a trace builder of AVM. Only serves to set the capacity of the
+ * @brief Constructor of a trace builder of AVM. Only serves to allocate the columns of the
  *        underlying traces.
  */
 AvmTraceBuilder::AvmTraceBuilder()
 {
-    main_trace.reserve(AVM_TRACE_SIZE);
+    allocate_main_trace();
 }
 
 /**
@@ -27,11 +27,39 @@ AvmTraceBuilder::AvmTraceBuilder()
  */
 void AvmTraceBuilder::reset()
 {
-    main_trace.clear();
+    allocate_main_trace();
     mem_trace_builder.reset();
     alu_trace_builder.reset();
 }
 
+/**
+ * @brief Allocate zeroed columns of AVM_TRACE_SIZE rows, which the whole trace is written into. The shifted
+ *        columns are left empty, they are derived by the circuit builder.
+ */
+void AvmTraceBuilder::allocate_main_trace()
+{
+    main_trace = TraceColumns();
+    for (auto& column : main_trace.get_unshifted()) {
+        column = Flavor::Polynomial(AVM_TRACE_SIZE);
+    }
+    main_trace_size = 0;
+}
+
+/**
+ * @brief Add a row to the main trace.
+ *
+ * @throws runtime_error exception when the trace is full.
+ * @return The index of the row in the columns, which is its clock plus one as the first row is reserved for the
+ *         shifted values.
+ */
+size_t AvmTraceBuilder::append_main_row()
+{
+    if (main_trace_size + 1 >= AVM_TRACE_SIZE) {
+        throw_or_abort("AVM trace is full");
+    }
+    return ++main_trace_size;
+}
+
 /**
  * @brief Addition with direct memory access.
  *
@@ -42,7 +70,7 @@ void AvmTraceBuilder::reset()
  */
 void AvmTraceBuilder::op_add(uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Reading from memory and loading into ia resp. ib.
     auto read_a = mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, a_offset, in_tag);
@@ -57,24 +85,23 @@ void AvmTraceBuilder::op_add(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
     // Write into memory value c from intermediate register ic.
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, c, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_op_add = FF(1),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!tag_match)),
-        .avm_main_ia = a,
-        .avm_main_ib = b,
-        .avm_main_ic = c,
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_mem_op_b = FF(1),
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_a = FF(a_offset),
-        .avm_main_mem_idx_b = FF(b_offset),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_op_add[row] = FF(1);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!tag_match));
+    main_trace.avm_main_ia[row] = a;
+    main_trace.avm_main_ib[row] = b;
+    main_trace.avm_main_ic[row] = c;
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_mem_op_b[row] = FF(1);
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_a[row] = FF(a_offset);
+    main_trace.avm_main_mem_idx_b[row] = FF(b_offset);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 };
 
 /**
@@ -87,7 +114,7 @@ void AvmTraceBuilder::op_add(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
  */
 void AvmTraceBuilder::op_sub(uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Reading from memory and loading into ia resp. ib.
     auto read_a = mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, a_offset, in_tag);
@@ -102,24 +129,23 @@ void AvmTraceBuilder::op_sub(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
     // Write into memory value c from intermediate register ic.
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, c, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_op_sub = FF(1),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!tag_match)),
-        .avm_main_ia = a,
-        .avm_main_ib = b,
-        .avm_main_ic = c,
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_mem_op_b = FF(1),
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_a = FF(a_offset),
-        .avm_main_mem_idx_b = FF(b_offset),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_op_sub[row] = FF(1);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!tag_match));
+    main_trace.avm_main_ia[row] = a;
+    main_trace.avm_main_ib[row] = b;
+    main_trace.avm_main_ic[row] = c;
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_mem_op_b[row] = FF(1);
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_a[row] = FF(a_offset);
+    main_trace.avm_main_mem_idx_b[row] = FF(b_offset);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 };
 
 /**
@@ -132,7 +158,7 @@ void AvmTraceBuilder::op_sub(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
  */
 void AvmTraceBuilder::op_mul(uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Reading from memory and loading into ia resp. ib.
     auto read_a = mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, a_offset, in_tag);
@@ -147,24 +173,23 @@ void AvmTraceBuilder::op_mul(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
     // Write into memory value c from intermediate register ic.
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, c, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_op_mul = FF(1),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!tag_match)),
-        .avm_main_ia = a,
-        .avm_main_ib = b,
-        .avm_main_ic = c,
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_mem_op_b = FF(1),
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_a = FF(a_offset),
-        .avm_main_mem_idx_b = FF(b_offset),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_op_mul[row] = FF(1);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!tag_match));
+    main_trace.avm_main_ia[row] = a;
+    main_trace.avm_main_ib[row] = b;
+    main_trace.avm_main_ic[row] = c;
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_mem_op_b[row] = FF(1);
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_a[row] = FF(a_offset);
+    main_trace.avm_main_mem_idx_b[row] = FF(b_offset);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 }
 
 /** TODO: Implement for non finite field types
@@ -177,7 +202,7 @@ void AvmTraceBuilder::op_mul(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
  */
 void AvmTraceBuilder::op_div(uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Reading from memory and loading into ia resp. ib.
     auto read_a = mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, a_offset, in_tag);
@@ -205,26 +230,25 @@ void AvmTraceBuilder::op_div(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
     // Write into memory value c from intermediate register ic.
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, c, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_op_div = FF(1),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_op_err = tag_match ? error : FF(1),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!tag_match)),
-        .avm_main_inv = tag_match ? inv : FF(1),
-        .avm_main_ia = tag_match ? a : FF(0),
-        .avm_main_ib = tag_match ? b : FF(0),
-        .avm_main_ic = tag_match ? c : FF(0),
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_mem_op_b = FF(1),
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_a = FF(a_offset),
-        .avm_main_mem_idx_b = FF(b_offset),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_op_div[row] = FF(1);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_op_err[row] = tag_match ? error : FF(1);
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!tag_match));
+    main_trace.avm_main_inv[row] = tag_match ? inv : FF(1);
+    main_trace.avm_main_ia[row] = tag_match ? a : FF(0);
+    main_trace.avm_main_ib[row] = tag_match ? b : FF(0);
+    main_trace.avm_main_ic[row] = tag_match ? c : FF(0);
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_mem_op_b[row] = FF(1);
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_a[row] = FF(a_offset);
+    main_trace.avm_main_mem_idx_b[row] = FF(b_offset);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 }
 
 /**
@@ -236,7 +260,7 @@ void AvmTraceBuilder::op_div(uint32_t a_offset, uint32_t b_offset, uint32_t dst_
  */
 void AvmTraceBuilder::op_not(uint32_t a_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Reading from memory and loading into ia.
     auto read_a = mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, a_offset, in_tag);
@@ -252,21 +276,20 @@ void AvmTraceBuilder::op_not(uint32_t a_offset, uint32_t dst_offset, AvmMemoryTa
     // Write into memory value c from intermediate register ic.
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, c, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_op_not = FF(1),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!read_a.tag_match)),
-        .avm_main_ia = a,
-        .avm_main_ic = c,
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_a = FF(a_offset),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_op_not[row] = FF(1);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!read_a.tag_match));
+    main_trace.avm_main_ia[row] = a;
+    main_trace.avm_main_ic[row] = c;
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_a[row] = FF(a_offset);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 };
 
 /**
@@ -279,7 +302,7 @@ void AvmTraceBuilder::op_not(uint32_t a_offset, uint32_t dst_offset, AvmMemoryTa
  */
 void AvmTraceBuilder::op_eq(uint32_t a_offset, uint32_t b_offset, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Reading from memory and loading into ia resp. ib.
     auto read_a = mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, a_offset, in_tag);
@@ -299,24 +322,23 @@ void AvmTraceBuilder::op_eq(uint32_t a_offset, uint32_t b_offset, uint32_t dst_o
     // Write into memory value c from intermediate register ic.
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, c, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_op_eq = FF(1),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!tag_match)),
-        .avm_main_ia = a,
-        .avm_main_ib = b,
-        .avm_main_ic = c,
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_mem_op_b = FF(1),
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_a = FF(a_offset),
-        .avm_main_mem_idx_b = FF(b_offset),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_op_eq[row] = FF(1);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!tag_match));
+    main_trace.avm_main_ia[row] = a;
+    main_trace.avm_main_ib[row] = b;
+    main_trace.avm_main_ic[row] = c;
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_mem_op_b[row] = FF(1);
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_a[row] = FF(a_offset);
+    main_trace.avm_main_mem_idx_b[row] = FF(b_offset);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 }
 
 // TODO: Finish SET opcode implementation. This is a partial implementation
@@ -334,21 +356,20 @@ void AvmTraceBuilder::op_eq(uint32_t a_offset, uint32_t b_offset, uint32_t dst_o
  */
 void AvmTraceBuilder::set(uint128_t val, uint32_t dst_offset, AvmMemoryTag in_tag)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
     auto val_ff = FF{ uint256_t::from_uint128(val) };
 
     mem_trace_builder.write_into_memory(clk, IntermRegister::IC, dst_offset, val_ff, in_tag);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc++),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_in_tag = FF(static_cast<uint32_t>(in_tag)),
-        .avm_main_ic = val_ff,
-        .avm_main_mem_op_c = FF(1),
-        .avm_main_rwc = FF(1),
-        .avm_main_mem_idx_c = FF(dst_offset),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc++);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(in_tag));
+    main_trace.avm_main_ic[row] = val_ff;
+    main_trace.avm_main_mem_op_c[row] = FF(1);
+    main_trace.avm_main_rwc[row] = FF(1);
+    main_trace.avm_main_mem_idx_c[row] = FF(dst_offset);
 }
 
 /**
@@ -394,7 +415,7 @@ void AvmTraceBuilder::calldata_copy(uint32_t cd_offset,
         uint32_t mem_idx_c(0);
         uint32_t rwb(0);
         uint32_t rwc(0);
-        auto clk = static_cast<uint32_t>(main_trace.size());
+        auto clk = main_trace_size;
 
         FF ia = call_data_mem.at(cd_offset + pos);
         uint32_t mem_op_a(1);
@@ -424,24 +445,23 @@ void AvmTraceBuilder::calldata_copy(uint32_t cd_offset,
             mem_trace_builder.write_into_memory(clk, IntermRegister::IC, mem_idx_c, ic, AvmMemoryTag::FF);
         }
 
-        main_trace.push_back(Row{
-            .avm_main_clk = clk,
-            .avm_main_pc = FF(pc++),
-            .avm_main_internal_return_ptr = FF(internal_return_ptr),
-            .avm_main_in_tag = FF(static_cast<uint32_t>(AvmMemoryTag::FF)),
-            .avm_main_ia = ia,
-            .avm_main_ib = ib,
-            .avm_main_ic = ic,
-            .avm_main_mem_op_a = FF(mem_op_a),
-            .avm_main_mem_op_b = FF(mem_op_b),
-            .avm_main_mem_op_c = FF(mem_op_c),
-            .avm_main_rwa = FF(rwa),
-            .avm_main_rwb = FF(rwb),
-            .avm_main_rwc = FF(rwc),
-            .avm_main_mem_idx_a = FF(mem_idx_a),
-            .avm_main_mem_idx_b = FF(mem_idx_b),
-            .avm_main_mem_idx_c = FF(mem_idx_c),
-        });
+        const size_t row = append_main_row();
+        main_trace.avm_main_clk[row] = clk;
+        main_trace.avm_main_pc[row] = FF(pc++);
+        main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+        main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(AvmMemoryTag::FF));
+        main_trace.avm_main_ia[row] = ia;
+        main_trace.avm_main_ib[row] = ib;
+        main_trace.avm_main_ic[row] = ic;
+        main_trace.avm_main_mem_op_a[row] = FF(mem_op_a);
+        main_trace.avm_main_mem_op_b[row] = FF(mem_op_b);
+        main_trace.avm_main_mem_op_c[row] = FF(mem_op_c);
+        main_trace.avm_main_rwa[row] = FF(rwa);
+        main_trace.avm_main_rwb[row] = FF(rwb);
+        main_trace.avm_main_rwc[row] = FF(rwc);
+        main_trace.avm_main_mem_idx_a[row] = FF(mem_idx_a);
+        main_trace.avm_main_mem_idx_b[row] = FF(mem_idx_b);
+        main_trace.avm_main_mem_idx_c[row] = FF(mem_idx_c);
 
         if (copy_size - pos > 2) { // Guard to prevent overflow if copy_size is close to uint32_t maximum value.
             pos += 3;
@@ -489,7 +509,7 @@ std::vector<FF> AvmTraceBuilder::return_op(uint32_t ret_offset, uint32_t ret_siz
         uint32_t mem_op_c(0);
         uint32_t mem_idx_b(0);
         uint32_t mem_idx_c(0);
-        auto clk = static_cast<uint32_t>(main_trace.size());
+        auto clk = main_trace_size;
 
         uint32_t mem_op_a(1);
         uint32_t mem_idx_a = ret_offset + pos;
@@ -525,23 +545,22 @@ std::vector<FF> AvmTraceBuilder::return_op(uint32_t ret_offset, uint32_t ret_siz
             returnMem.push_back(ic);
         }
 
-        main_trace.push_back(Row{
-            .avm_main_clk = clk,
-            .avm_main_pc = FF(pc),
-            .avm_main_internal_return_ptr = FF(internal_return_ptr),
-            .avm_main_sel_halt = FF(1),
-            .avm_main_in_tag = FF(static_cast<uint32_t>(AvmMemoryTag::FF)),
-            .avm_main_tag_err = FF(static_cast<uint32_t>(!tag_match)),
-            .avm_main_ia = tag_match ? ia : FF(0),
-            .avm_main_ib = tag_match ? ib : FF(0),
-            .avm_main_ic = tag_match ? ic : FF(0),
-            .avm_main_mem_op_a = FF(mem_op_a),
-            .avm_main_mem_op_b = FF(mem_op_b),
-            .avm_main_mem_op_c = FF(mem_op_c),
-            .avm_main_mem_idx_a = FF(mem_idx_a),
-            .avm_main_mem_idx_b = FF(mem_idx_b),
-            .avm_main_mem_idx_c = FF(mem_idx_c),
-        });
+        const size_t row = append_main_row();
+        main_trace.avm_main_clk[row] = clk;
+        main_trace.avm_main_pc[row] = FF(pc);
+        main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+        main_trace.avm_main_sel_halt[row] = FF(1);
+        main_trace.avm_main_in_tag[row] = FF(static_cast<uint32_t>(AvmMemoryTag::FF));
+        main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!tag_match));
+        main_trace.avm_main_ia[row] = tag_match ? ia : FF(0);
+        main_trace.avm_main_ib[row] = tag_match ? ib : FF(0);
+        main_trace.avm_main_ic[row] = tag_match ? ic : FF(0);
+        main_trace.avm_main_mem_op_a[row] = FF(mem_op_a);
+        main_trace.avm_main_mem_op_b[row] = FF(mem_op_b);
+        main_trace.avm_main_mem_op_c[row] = FF(mem_op_c);
+        main_trace.avm_main_mem_idx_a[row] = FF(mem_idx_a);
+        main_trace.avm_main_mem_idx_b[row] = FF(mem_idx_b);
+        main_trace.avm_main_mem_idx_c[row] = FF(mem_idx_c);
 
         if (ret_size - pos > 2) { // Guard to prevent overflow if ret_size is close to uint32_t maximum value.
             pos += 3;
@@ -561,14 +580,13 @@ std::vector<FF> AvmTraceBuilder::return_op(uint32_t ret_offset, uint32_t ret_siz
  */
 void AvmTraceBuilder::halt()
 {
-    auto clk = main_trace.size();
+    auto clk = main_trace_size;
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_halt = FF(1),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_halt[row] = FF(1);
 
     pc = UINT32_MAX; // This ensures that no subsequent opcode will be executed.
 }
@@ -583,15 +601,14 @@ void AvmTraceBuilder::halt()
  */
 void AvmTraceBuilder::jump(uint32_t jmp_dest)
 {
-    auto clk = main_trace.size();
+    auto clk = main_trace_size;
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_jump = FF(1),
-        .avm_main_ia = FF(jmp_dest),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_jump[row] = FF(1);
+    main_trace.avm_main_ia[row] = FF(jmp_dest);
 
     // Adjust parameters for the next row
     pc = jmp_dest;
@@ -612,7 +629,7 @@ void AvmTraceBuilder::jump(uint32_t jmp_dest)
  */
 void AvmTraceBuilder::internal_call(uint32_t jmp_dest)
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // We store the next instruction as the return location
     uint32_t stored_pc = pc + 1;
@@ -621,17 +638,16 @@ void AvmTraceBuilder::internal_call(uint32_t jmp_dest)
     // Add the return location to the memory trace
     mem_trace_builder.write_into_memory(clk, IntermRegister::IB, internal_return_ptr, FF(stored_pc), AvmMemoryTag::FF);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = FF(pc),
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_internal_call = FF(1),
-        .avm_main_ia = FF(jmp_dest),
-        .avm_main_ib = stored_pc,
-        .avm_main_mem_op_b = FF(1),
-        .avm_main_rwb = FF(1),
-        .avm_main_mem_idx_b = FF(internal_return_ptr),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = FF(pc);
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_internal_call[row] = FF(1);
+    main_trace.avm_main_ia[row] = FF(jmp_dest);
+    main_trace.avm_main_ib[row] = stored_pc;
+    main_trace.avm_main_mem_op_b[row] = FF(1);
+    main_trace.avm_main_rwb[row] = FF(1);
+    main_trace.avm_main_mem_idx_b[row] = FF(internal_return_ptr);
 
     // Adjust parameters for the next row
     pc = jmp_dest;
@@ -650,24 +666,23 @@ void AvmTraceBuilder::internal_call(uint32_t jmp_dest)
  */
 void AvmTraceBuilder::internal_return()
 {
-    auto clk = static_cast<uint32_t>(main_trace.size());
+    auto clk = main_trace_size;
 
     // Internal return pointer is decremented
     // We want to load the value pointed by the internal pointer
     auto read_a =
         mem_trace_builder.read_and_load_from_memory(clk, IntermRegister::IA, internal_return_ptr - 1, AvmMemoryTag::FF);
 
-    main_trace.push_back(Row{
-        .avm_main_clk = clk,
-        .avm_main_pc = pc,
-        .avm_main_internal_return_ptr = FF(internal_return_ptr),
-        .avm_main_sel_internal_return = FF(1),
-        .avm_main_tag_err = FF(static_cast<uint32_t>(!read_a.tag_match)),
-        .avm_main_ia = read_a.tag_match ? read_a.val : FF(0),
-        .avm_main_mem_op_a = FF(1),
-        .avm_main_rwa = FF(0),
-        .avm_main_mem_idx_a = FF(internal_return_ptr - 1),
-    });
+    const size_t row = append_main_row();
+    main_trace.avm_main_clk[row] = clk;
+    main_trace.avm_main_pc[row] = pc;
+    main_trace.avm_main_internal_return_ptr[row] = FF(internal_return_ptr);
+    main_trace.avm_main_sel_internal_return[row] = FF(1);
+    main_trace.avm_main_tag_err[row] = FF(static_cast<uint32_t>(!read_a.tag_match));
+    main_trace.avm_main_ia[row] = read_a.tag_match ? read_a.val : FF(0);
+    main_trace.avm_main_mem_op_a[row] = FF(1);
+    main_trace.avm_main_rwa[row] = FF(0);
+    main_trace.avm_main_mem_idx_a[row] = FF(internal_return_ptr - 1);
 
     // We want the next row to be the one pointed by jmp_dest
     // The next pc should be from the top of the internal call stack + 1
@@ -686,7 +701,7 @@ void AvmTraceBuilder::internal_return()
 void AvmTraceBuilder::finalise_mem_trace_lookup_counts(std::map<uint32_t, uint32_t> const& tag_err_lookup_counts)
 {
     for (auto const& [clk, count] : tag_err_lookup_counts) {
-        main_trace.at(clk).equiv_tag_err_counts = count;
+        main_trace.equiv_tag_err_counts[clk + 1] = count;
     }
 }
 
@@ -696,103 +711,119 @@ void AvmTraceBuilder::finalise_mem_trace_lookup_counts(std::map<uint32_t, uint32
  *        adding shifted values (first row). The main trace is moved at the end of
  *        this call.
  *
- * @return The main trace
+ * @throws runtime_error exception when the memory or alu trace does not fit in the columns.
+ * @return The columns of the trace, without the shifted ones
  */
-std::vector<Row> AvmTraceBuilder::finalize()
+TraceColumns AvmTraceBuilder::finalize()
 {
     auto mem_trace = mem_trace_builder.finalize();
     auto alu_trace = alu_trace_builder.finalize();
     size_t mem_trace_size = mem_trace.size();
-    size_t main_trace_size = main_trace.size();
     size_t alu_trace_size = alu_trace.size();
 
     // Get tag_err counts from the mem_trace_builder
     this->finalise_mem_trace_lookup_counts(mem_trace_builder.m_tag_err_lookup_counts);
 
-    // TODO: We will have to handle this through error handling and not an assertion
     // Smaller than N because we have to add an extra initial row to support shifted
     // elements
-    assert(mem_trace_size < AVM_TRACE_SIZE);
-    assert(main_trace_size < AVM_TRACE_SIZE);
-    assert(alu_trace_size < AVM_TRACE_SIZE);
-
-    // Fill the rest with zeros.
-    size_t zero_rows_num = AVM_TRACE_SIZE - main_trace_size - 1;
-    while (zero_rows_num-- > 0) {
-        main_trace.push_back({});
+    if (mem_trace_size >= AVM_TRACE_SIZE || alu_trace_size >= AVM_TRACE_SIZE) {
+        throw_or_abort("AVM trace is full");
     }
 
-    main_trace.at(main_trace_size - 1).avm_main_last = FF(1);
-
-    // Memory trace inclusion
-    for (size_t i = 0; i < mem_trace_size; i++) {
-        auto const& src = mem_trace.at(i);
-        auto& dest = main_trace.at(i);
-
-        dest.avm_mem_m_clk = FF(src.m_clk);
-        dest.avm_mem_m_sub_clk = FF(src.m_sub_clk);
-        dest.avm_mem_m_addr = FF(src.m_addr);
-        dest.avm_mem_m_val = src.m_val;
-        dest.avm_mem_m_rw = FF(static_cast<uint32_t>(src.m_rw));
-        dest.avm_mem_m_in_tag = FF(static_cast<uint32_t>(src.m_in_tag));
-        dest.avm_mem_m_tag = FF(static_cast<uint32_t>(src.m_tag));
-        dest.avm_mem_m_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
-        dest.avm_mem_m_one_min_inv = src.m_one_min_inv;
-
-        if (i + 1 < mem_trace_size) {
-            auto const& next = mem_trace.at(i + 1);
-            dest.avm_mem_m_lastAccess = FF(static_cast<uint32_t>(src.m_addr != next.m_addr));
-        } else {
-            dest.avm_mem_m_lastAccess = FF(1);
-            dest.avm_mem_m_last = FF(1);
-        }
-    }
+    // The rows past the end of the traces are already zero
+    main_trace.avm_main_last[main_trace_size] = FF(1);
+
+    // Memory trace inclusion, the entries are independent of each other and written on every thread
+    run_loop_in_parallel_if_effective(
+        mem_trace_size,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                auto const& src = mem_trace.at(i);
+                const size_t row = i + 1;
+
+                main_trace.avm_mem_m_clk[row] = FF(src.m_clk);
+                main_trace.avm_mem_m_sub_clk[row] = FF(src.m_sub_clk);
+                main_trace.avm_mem_m_addr[row] = FF(src.m_addr);
+                main_trace.avm_mem_m_val[row] = src.m_val;
+                main_trace.avm_mem_m_rw[row] = FF(static_cast<uint32_t>(src.m_rw));
+                main_trace.avm_mem_m_in_tag[row] = FF(static_cast<uint32_t>(src.m_in_tag));
+                main_trace.avm_mem_m_tag[row] = FF(static_cast<uint32_t>(src.m_tag));
+                main_trace.avm_mem_m_tag_err[row] = FF(static_cast<uint32_t>(src.m_tag_err));
+                main_trace.avm_mem_m_one_min_inv[row] = src.m_one_min_inv;
+
+                if (i + 1 < mem_trace_size) {
+                    auto const& next = mem_trace.at(i + 1);
+                    main_trace.avm_mem_m_lastAccess[row] = FF(static_cast<uint32_t>(src.m_addr != next.m_addr));
+                } else {
+                    main_trace.avm_mem_m_lastAccess[row] = FF(1);
+                    main_trace.avm_mem_m_last[row] = FF(1);
+                }
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/0,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/0,
+        /*group_element_doublings_per_iteration=*/0,
+        /*scalar_multiplications_per_iteration=*/0,
+        /*sequential_copy_ops_per_iteration=*/11);
 
     // Alu trace inclusion
-    for (size_t i = 0; i < alu_trace_size; i++) {
-        auto const& src = alu_trace.at(i);
-        auto& dest = main_trace.at(i);
-
-        dest.avm_alu_alu_clk = FF(static_cast<uint32_t>(src.alu_clk));
-
-        dest.avm_alu_alu_op_add = FF(static_cast<uint32_t>(src.alu_op_add));
-        dest.avm_alu_alu_op_sub = FF(static_cast<uint32_t>(src.alu_op_sub));
-        dest.avm_alu_alu_op_mul = FF(static_cast<uint32_t>(src.alu_op_mul));
-        dest.avm_alu_alu_op_not = FF(static_cast<uint32_t>(src.alu_op_not));
-        dest.avm_alu_alu_op_eq = FF(static_cast<uint32_t>(src.alu_op_eq));
-
-        dest.avm_alu_alu_ff_tag = FF(static_cast<uint32_t>(src.alu_ff_tag));
-        dest.avm_alu_alu_u8_tag = FF(static_cast<uint32_t>(src.alu_u8_tag));
-        dest.avm_alu_alu_u16_tag = FF(static_cast<uint32_t>(src.alu_u16_tag));
-        dest.avm_alu_alu_u32_tag = FF(static_cast<uint32_t>(src.alu_u32_tag));
-        dest.avm_alu_alu_u64_tag = FF(static_cast<uint32_t>(src.alu_u64_tag));
-        dest.avm_alu_alu_u128_tag = FF(static_cast<uint32_t>(src.alu_u128_tag));
-
-        dest.avm_alu_alu_ia = src.alu_ia;
-        dest.avm_alu_alu_ib = src.alu_ib;
-        dest.avm_alu_alu_ic = src.alu_ic;
-
-        dest.avm_alu_alu_cf = FF(static_cast<uint32_t>(src.alu_cf));
-
-        dest.avm_alu_alu_u8_r0 = FF(src.alu_u8_r0);
-        dest.avm_alu_alu_u8_r1 = FF(src.alu_u8_r1);
-
-        dest.avm_alu_alu_u16_r0 = FF(src.alu_u16_reg.at(0));
-        dest.avm_alu_alu_u16_r1 = FF(src.alu_u16_reg.at(1));
-        dest.avm_alu_alu_u16_r2 = FF(src.alu_u16_reg.at(2));
-        dest.avm_alu_alu_u16_r3 = FF(src.alu_u16_reg.at(3));
-        dest.avm_alu_alu_u16_r4 = FF(src.alu_u16_reg.at(4));
-        dest.avm_alu_alu_u16_r5 = FF(src.alu_u16_reg.at(5));
-        dest.avm_alu_alu_u16_r6 = FF(src.alu_u16_reg.at(6));
-        dest.avm_alu_alu_u16_r7 = FF(src.alu_u16_reg.at(7));
-
-        dest.avm_alu_alu_u64_r0 = FF(src.alu_u64_r0);
-        dest.avm_alu_alu_op_eq_diff_inv = FF(src.alu_op_eq_diff_inv);
-    }
+    run_loop_in_parallel_if_effective(
+        alu_trace_size,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                auto const& src = alu_trace.at(i);
+                const size_t row = i + 1;
+
+                main_trace.avm_alu_alu_clk[row] = FF(static_cast<uint32_t>(src.alu_clk));
+
+                main_trace.avm_alu_alu_op_add[row] = FF(static_cast<uint32_t>(src.alu_op_add));
+                main_trace.avm_alu_alu_op_sub[row] = FF(static_cast<uint32_t>(src.alu_op_sub));
+                main_trace.avm_alu_alu_op_mul[row] = FF(static_cast<uint32_t>(src.alu_op_mul));
+                main_trace.avm_alu_alu_op_not[row] = FF(static_cast<uint32_t>(src.alu_op_not));
+                main_trace.avm_alu_alu_op_eq[row] = FF(static_cast<uint32_t>(src.alu_op_eq));
+
+                main_trace.avm_alu_alu_ff_tag[row] = FF(static_cast<uint32_t>(src.alu_ff_tag));
+                main_trace.avm_alu_alu_u8_tag[row] = FF(static_cast<uint32_t>(src.alu_u8_tag));
+                main_trace.avm_alu_alu_u16_tag[row] = FF(static_cast<uint32_t>(src.alu_u16_tag));
+                main_trace.avm_alu_alu_u32_tag[row] = FF(static_cast<uint32_t>(src.alu_u32_tag));
+                main_trace.avm_alu_alu_u64_tag[row] = FF(static_cast<uint32_t>(src.alu_u64_tag));
+                main_trace.avm_alu_alu_u128_tag[row] = FF(static_cast<uint32_t>(src.alu_u128_tag));
+
+                main_trace.avm_alu_alu_ia[row] = src.alu_ia;
+                main_trace.avm_alu_alu_ib[row] = src.alu_ib;
+                main_trace.avm_alu_alu_ic[row] = src.alu_ic;
+
+                main_trace.avm_alu_alu_cf[row] = FF(static_cast<uint32_t>(src.alu_cf));
+
+                main_trace.avm_alu_alu_u8_r0[row] = FF(src.alu_u8_r0);
+                main_trace.avm_alu_alu_u8_r1[row] = FF(src.alu_u8_r1);
+
+                main_trace.avm_alu_alu_u16_r0[row] = FF(src.alu_u16_reg.at(0));
+                main_trace.avm_alu_alu_u16_r1[row] = FF(src.alu_u16_reg.at(1));
+                main_trace.avm_alu_alu_u16_r2[row] = FF(src.alu_u16_reg.at(2));
+                main_trace.avm_alu_alu_u16_r3[row] = FF(src.alu_u16_reg.at(3));
+                main_trace.avm_alu_alu_u16_r4[row] = FF(src.alu_u16_reg.at(4));
+                main_trace.avm_alu_alu_u16_r5[row] = FF(src.alu_u16_reg.at(5));
+                main_trace.avm_alu_alu_u16_r6[row] = FF(src.alu_u16_reg.at(6));
+                main_trace.avm_alu_alu_u16_r7[row] = FF(src.alu_u16_reg.at(7));
+
+                main_trace.avm_alu_alu_u64_r0[row] = FF(src.alu_u64_r0);
+                main_trace.avm_alu_alu_op_eq_diff_inv[row] = FF(src.alu_op_eq_diff_inv);
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/0,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/0,
+        /*group_element_doublings_per_iteration=*/0,
+        /*scalar_multiplications_per_iteration=*/0,
+        /*sequential_copy_ops_per_iteration=*/29);
 
     // Adding extra row for the shifted values at the top of the execution trace.
-    Row first_row = Row{ .avm_main_first = FF(1), .avm_mem_m_lastAccess = FF(1) };
-    main_trace.insert(main_trace.begin(), first_row);
+    main_trace.avm_main_first[0] = FF(1);
+    main_trace.avm_mem_m_lastAccess[0] = FF(1);
 
     auto trace = std::move(main_trace);
     reset();
@@ -14,8 +14,8 @@ namespace bb::avm_trace {
 
 // This is the internal context that we keep along the lifecycle of bytecode execution
 // to iteratively build the whole trace. This is effectively performing witness generation.
-// At the end of circuit building, mainTrace can be moved to AvmCircuitBuilder by calling
-// AvmCircuitBuilder::set_trace(rows).
+// The trace is written directly into preallocated columns, which can be moved to AvmCircuitBuilder
+// at the end of circuit building by calling AvmCircuitBuilder::set_trace(columns).
 class AvmTraceBuilder {
 
   public:
@@ -23,7 +23,7 @@ class AvmTraceBuilder {
 
     AvmTraceBuilder();
 
-    std::vector<Row> finalize();
+    TraceColumns finalize();
     void reset();
 
     uint32_t getPc() const { return pc; }
@@ -74,10 +74,15 @@ class AvmTraceBuilder {
     std::vector<FF> return_op(uint32_t ret_offset, uint32_t ret_size);
 
   private:
-    std::vector<Row> main_trace;
+    TraceColumns main_trace;
+    // Number of rows of the main trace, i.e. the clock of the next row
+    uint32_t main_trace_size = 0;
     AvmMemTraceBuilder mem_trace_builder;
     AvmAluTraceBuilder alu_trace_builder;
 
+    void allocate_main_trace();
+    size_t append_main_row();
+
     void finalise_mem_trace_lookup_counts(std::map<uint32_t, uint32_t> const& tag_err_lookup_counts);
 
     uint32_t pc = 0;
@@ -19,7 +19,8 @@ void ToyComposer::compute_witness(CircuitConstructor& circuit)
 
     for (auto [key_poly, prover_poly] : zip_view(proving_key->get_all(), polynomials.get_unshifted())) {
         ASSERT(flavor_get_label(*proving_key, key_poly) == flavor_get_label(polynomials, prover_poly));
-        key_poly = prover_poly;
+        // The prover polynomials are not used past this point, so hand their memory over instead of copying
+        key_poly = std::move(prover_poly);
     }
 
     computed_witness = true;
@@ -172,7 +172,7 @@ std::vector<Row> gen_mutated_trace_add(FF const& a, FF const& b, FF const& c_mut
     trace_builder.set(uint128_t{ b }, 1, tag);
     trace_builder.op_add(0, 1, 2, tag);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto select_row = [](Row r) { return r.avm_main_sel_op_add == FF(1); };
     mutate_ic_in_trace(trace, select_row, c_mutated, true);
@@ -190,7 +190,7 @@ std::vector<Row> gen_mutated_trace_sub(FF const& a, FF const& b, FF const& c_mut
     trace_builder.set(uint128_t{ b }, 1, tag);
     trace_builder.op_sub(0, 1, 2, tag);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto select_row = [](Row r) { return r.avm_main_sel_op_sub == FF(1); };
     mutate_ic_in_trace(trace, select_row, c_mutated, true);
@@ -208,7 +208,7 @@ std::vector<Row> gen_mutated_trace_mul(FF const& a, FF const& b, FF const& c_mut
     trace_builder.set(uint128_t{ b }, 1, tag);
     trace_builder.op_mul(0, 1, 2, tag);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto select_row = [](Row r) { return r.avm_main_sel_op_mul == FF(1); };
     mutate_ic_in_trace(trace, select_row, c_mutated, true);
@@ -229,7 +229,7 @@ std::vector<Row> gen_mutated_trace_eq(
     trace_builder.set(uint128_t{ b }, 1, tag);
     trace_builder.op_eq(0, 1, 2, tag);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto select_row = [](Row r) { return r.avm_main_sel_op_eq == FF(1); };
     mutate_ic_in_trace(trace, select_row, c_mutated, true);
@@ -308,7 +308,7 @@ TEST_F(AvmArithmeticTestsFF, addition)
     //                             Memory layout:    [37,4,11,0,0,0,....]
     trace_builder.op_add(0, 1, 4, AvmMemoryTag::FF); // [37,4,11,0,41,0,....]
     trace_builder.return_op(0, 5);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace, FF(37), FF(4), FF(41), FF(0), FF(1), FF(4), AvmMemoryTag::FF);
 
@@ -327,7 +327,7 @@ TEST_F(AvmArithmeticTestsFF, subtraction)
     //                             Memory layout:    [8,4,17,0,0,0,....]
     trace_builder.op_sub(2, 0, 1, AvmMemoryTag::FF); // [8,9,17,0,0,0....]
     trace_builder.return_op(0, 3);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace, FF(17), FF(8), FF(9), FF(2), FF(0), FF(1), AvmMemoryTag::FF);
 
@@ -346,7 +346,7 @@ TEST_F(AvmArithmeticTestsFF, multiplication)
     //                             Memory layout:    [5,0,20,0,0,0,....]
     trace_builder.op_mul(2, 0, 1, AvmMemoryTag::FF); // [5,100,20,0,0,0....]
     trace_builder.return_op(0, 3);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace, FF(20), FF(5), FF(100), FF(2), FF(0), FF(1), AvmMemoryTag::FF);
     auto alu_row = trace.at(alu_row_index);
@@ -366,7 +366,7 @@ TEST_F(AvmArithmeticTestsFF, multiplicationByZero)
     //                             Memory layout:    [127,0,0,0,0,0,....]
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::FF); // [127,0,0,0,0,0....]
     trace_builder.return_op(0, 3);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace, FF(127), FF(0), FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::FF);
     auto alu_row = trace.at(alu_row_index);
@@ -386,7 +386,7 @@ TEST_F(AvmArithmeticTestsFF, division)
     //                             Memory layout:    [15,315,0,0,0,0,....]
     trace_builder.op_div(1, 0, 2, AvmMemoryTag::FF); // [15,315,21,0,0,0....]
     trace_builder.return_op(0, 3);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -409,7 +409,7 @@ TEST_F(AvmArithmeticTestsFF, divisionNumeratorZero)
     //                             Memory layout:    [15,0,0,0,0,0,....]
     trace_builder.op_div(1, 0, 0, AvmMemoryTag::FF); // [0,0,0,0,0,0....]
     trace_builder.return_op(0, 3);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -433,7 +433,7 @@ TEST_F(AvmArithmeticTestsFF, divisionByZeroError)
     //                             Memory layout:    [15,0,0,0,0,0,....]
     trace_builder.op_div(0, 1, 2, AvmMemoryTag::FF); // [15,0,0,0,0,0....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -456,7 +456,7 @@ TEST_F(AvmArithmeticTestsFF, divisionZeroByZeroError)
     //                             Memory layout:    [0,0,0,0,0,0,....]
     trace_builder.op_div(0, 1, 2, AvmMemoryTag::FF); // [0,0,0,0,0,0....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -493,7 +493,7 @@ TEST_F(AvmArithmeticTestsFF, mixedOperationsWithError)
         9, 0, 4, AvmMemoryTag::FF); // [0,23*136^(-1),45,23,1/0,136,0,136,136^2,1,0....] Error: division by 0
     trace_builder.halt();
 
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
     validate_trace_proof(std::move(trace));
 }
 
@@ -505,7 +505,7 @@ TEST_F(AvmArithmeticTestsFF, equality)
     trace_builder.calldata_copy(0, 3, 0, std::vector<FF>{ elem, elem, 1 });
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::FF); // Memory Layout [q - 1, q -1, 1,0..]
     trace_builder.return_op(0, 3);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace, elem, elem, FF(1), FF(0), FF(1), FF(2), AvmMemoryTag::FF);
     auto alu_row = trace.at(alu_row_index);
@@ -522,7 +522,7 @@ TEST_F(AvmArithmeticTestsFF, nonEquality)
     trace_builder.calldata_copy(0, 3, 0, std::vector<FF>{ elem, elem + FF(1), 0 });
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::FF); // Memory Layout [q - 1, q, 1,0..]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace, elem, FF(0), FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::FF);
     auto alu_row = trace.at(alu_row_index);
@@ -546,7 +546,7 @@ TEST_F(AvmArithmeticTestsU8, addition)
     //                             Memory layout:    [62,29,0,0,0,....]
     trace_builder.op_add(0, 1, 2, AvmMemoryTag::U8); // [62,29,91,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace, FF(62), FF(29), FF(91), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
 
@@ -567,7 +567,7 @@ TEST_F(AvmArithmeticTestsU8, additionCarry)
     //                             Memory layout:    [159,100,0,0,0,....]
     trace_builder.op_add(0, 1, 2, AvmMemoryTag::U8); // [159,100,3,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace, FF(159), FF(100), FF(3), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
 
@@ -589,7 +589,7 @@ TEST_F(AvmArithmeticTestsU8, subtraction)
     //                             Memory layout:    [162,29,0,0,0,....]
     trace_builder.op_sub(0, 1, 2, AvmMemoryTag::U8); // [162,29,133,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace, FF(162), FF(29), FF(133), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
 
@@ -611,7 +611,7 @@ TEST_F(AvmArithmeticTestsU8, subtractionCarry)
     //                             Memory layout:    [5,29,0,0,0,....]
     trace_builder.op_sub(0, 1, 2, AvmMemoryTag::U8); // [5,29,232,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace, FF(5), FF(29), FF(232), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
 
@@ -639,7 +639,7 @@ TEST_F(AvmArithmeticTestsU8, multiplication)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U8);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace, FF(13), FF(15), FF(195), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
     auto alu_row = trace.at(alu_row_index);
@@ -662,7 +662,7 @@ TEST_F(AvmArithmeticTestsU8, multiplicationOverflow)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U8);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace, FF(200), FF(170), FF(208), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
     auto alu_row = trace.at(alu_row_index);
@@ -684,7 +684,7 @@ TEST_F(AvmArithmeticTestsU8, equality)
     trace_builder.set(128, 1, AvmMemoryTag::U8);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U8); // Memory layout: [128,128,1,0,..,0]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace, FF(128), FF(128), FF(1), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
     auto alu_row = trace.at(alu_row_index);
@@ -701,7 +701,7 @@ TEST_F(AvmArithmeticTestsU8, nonEquality)
     trace_builder.set(200, 1, AvmMemoryTag::U8);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U8); // Memory layout: [84,200,0,0,..,0]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace, 84, 200, FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::U8);
     auto alu_row = trace.at(alu_row_index);
@@ -724,7 +724,7 @@ TEST_F(AvmArithmeticTestsU16, addition)
 
     trace_builder.op_add(546, 119, 5, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row =
         common_validate_add(trace, FF(33005), FF(1775), FF(34780), FF(546), FF(119), FF(5), AvmMemoryTag::U16);
@@ -746,7 +746,7 @@ TEST_F(AvmArithmeticTestsU16, additionCarry)
 
     trace_builder.op_add(1, 0, 0, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row =
         common_validate_add(trace, FF(1000), FF(UINT16_MAX - 982), FF(17), FF(1), FF(0), FF(0), AvmMemoryTag::U16);
@@ -768,7 +768,7 @@ TEST_F(AvmArithmeticTestsU16, subtraction)
 
     trace_builder.op_sub(546, 119, 5, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row =
         common_validate_sub(trace, FF(33005), FF(1775), FF(31230), FF(546), FF(119), FF(5), AvmMemoryTag::U16);
@@ -792,7 +792,7 @@ TEST_F(AvmArithmeticTestsU16, subtractionCarry)
 
     trace_builder.op_sub(1, 0, 0, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row =
         common_validate_sub(trace, FF(1000), FF(UINT16_MAX - 982), FF(1983), FF(1), FF(0), FF(0), AvmMemoryTag::U16);
@@ -821,7 +821,7 @@ TEST_F(AvmArithmeticTestsU16, multiplication)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index =
         common_validate_mul(trace, FF(200), FF(245), FF(49000), FF(0), FF(1), FF(2), AvmMemoryTag::U16);
@@ -846,7 +846,7 @@ TEST_F(AvmArithmeticTestsU16, multiplicationOverflow)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace, FF(512), FF(1024), FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::U16);
     auto alu_row = trace.at(alu_row_index);
@@ -870,7 +870,7 @@ TEST_F(AvmArithmeticTestsU16, equality)
     trace_builder.set(35823, 1, AvmMemoryTag::U16);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace, FF(35823), FF(35823), FF(1), FF(0), FF(1), FF(2), AvmMemoryTag::U16);
     auto alu_row = trace.at(alu_row_index);
@@ -887,7 +887,7 @@ TEST_F(AvmArithmeticTestsU16, nonEquality)
     trace_builder.set(50'123, 1, AvmMemoryTag::U16);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U16);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace, 35'823, 50'123, FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::U16);
     auto alu_row = trace.at(alu_row_index);
@@ -910,7 +910,7 @@ TEST_F(AvmArithmeticTestsU32, addition)
 
     trace_builder.op_add(8, 9, 0, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(
         trace, FF(1000000000), FF(1234567891), FF(2234567891LLU), FF(8), FF(9), FF(0), AvmMemoryTag::U32);
@@ -933,7 +933,7 @@ TEST_F(AvmArithmeticTestsU32, additionCarry)
 
     trace_builder.op_add(8, 9, 0, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row =
         common_validate_add(trace, FF(UINT32_MAX - 1293), FF(2293), FF(999), FF(8), FF(9), FF(0), AvmMemoryTag::U32);
@@ -955,7 +955,7 @@ TEST_F(AvmArithmeticTestsU32, subtraction)
 
     trace_builder.op_sub(8, 9, 0, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(
         trace, FF(1345678991), FF(1234567891), FF(111111100), FF(8), FF(9), FF(0), AvmMemoryTag::U32);
@@ -982,7 +982,7 @@ TEST_F(AvmArithmeticTestsU32, subtractionCarry)
 
     trace_builder.op_sub(9, 8, 0, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(
         trace, FF(3210987654LLU), FF(UINT32_MAX - 99), FF(3210987754LLU), FF(9), FF(8), FF(0), AvmMemoryTag::U32);
@@ -1013,7 +1013,7 @@ TEST_F(AvmArithmeticTestsU32, multiplication)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index =
         common_validate_mul(trace, FF(11111), FF(11111), FF(123454321), FF(0), FF(1), FF(2), AvmMemoryTag::U32);
@@ -1042,7 +1042,7 @@ TEST_F(AvmArithmeticTestsU32, multiplicationOverflow)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index =
         common_validate_mul(trace, FF(11 << 25), FF(13 << 22), FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::U32);
@@ -1069,7 +1069,7 @@ TEST_F(AvmArithmeticTestsU32, equality)
     trace_builder.set(0xb435e9c1, 1, AvmMemoryTag::U32);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index =
         common_validate_eq(trace, 0xb435e9c1, 0xb435e9c1, FF(1), FF(0), FF(1), FF(2), AvmMemoryTag::U32);
@@ -1087,7 +1087,7 @@ TEST_F(AvmArithmeticTestsU32, nonEquality)
     trace_builder.set(0xb435e9c0, 1, AvmMemoryTag::U32);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U32);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index =
         common_validate_eq(trace, 0xb435e9c1, 0xb435e9c0, FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::U32);
@@ -1115,7 +1115,7 @@ TEST_F(AvmArithmeticTestsU64, addition)
 
     trace_builder.op_add(8, 9, 9, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace, FF(a), FF(b), FF(c), FF(8), FF(9), FF(9), AvmMemoryTag::U64);
 
@@ -1145,7 +1145,7 @@ TEST_F(AvmArithmeticTestsU64, additionCarry)
 
     trace_builder.op_add(0, 1, 0, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace, FF(a), FF(b), FF(c), FF(0), FF(1), FF(0), AvmMemoryTag::U64);
 
@@ -1173,7 +1173,7 @@ TEST_F(AvmArithmeticTestsU64, subtraction)
 
     trace_builder.op_sub(8, 9, 9, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace, FF(a), FF(b), FF(c), FF(8), FF(9), FF(9), AvmMemoryTag::U64);
 
@@ -1205,7 +1205,7 @@ TEST_F(AvmArithmeticTestsU64, subtractionCarry)
 
     trace_builder.op_sub(0, 1, 0, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace, FF(a), FF(b), FF(c), FF(0), FF(1), FF(0), AvmMemoryTag::U64);
 
@@ -1233,7 +1233,7 @@ TEST_F(AvmArithmeticTestsU64, multiplication)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(
         trace, FF(999888777), FF(555444333), FF(555382554814950741LLU), FF(0), FF(1), FF(2), AvmMemoryTag::U64);
@@ -1266,7 +1266,7 @@ TEST_F(AvmArithmeticTestsU64, multiplicationOverflow)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace, FF(a), FF(b), FF(1), FF(0), FF(1), FF(2), AvmMemoryTag::U64);
     auto alu_row = trace.at(alu_row_index);
@@ -1294,7 +1294,7 @@ TEST_F(AvmArithmeticTestsU64, equality)
     trace_builder.set(0xffffffffffffffe0LLU, 1, AvmMemoryTag::U64);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(
         trace, 0xffffffffffffffe0LLU, 0xffffffffffffffe0LLU, FF(1), FF(0), FF(1), FF(2), AvmMemoryTag::U64);
@@ -1312,7 +1312,7 @@ TEST_F(AvmArithmeticTestsU64, nonEquality)
     trace_builder.set(0xffffffffffaeffe0LLU, 1, AvmMemoryTag::U64);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U64);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(
         trace, 0xffffffffffffffe0LLU, 0xffffffffffaeffe0LLU, FF(0), FF(0), FF(1), FF(2), AvmMemoryTag::U64);
@@ -1340,7 +1340,7 @@ TEST_F(AvmArithmeticTestsU128, addition)
 
     trace_builder.op_add(8, 9, 9, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace,
                                        FF(uint256_t::from_uint128(a)),
@@ -1380,7 +1380,7 @@ TEST_F(AvmArithmeticTestsU128, additionCarry)
 
     trace_builder.op_add(8, 9, 9, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_add(trace,
                                        FF(uint256_t::from_uint128(a)),
@@ -1419,7 +1419,7 @@ TEST_F(AvmArithmeticTestsU128, subtraction)
 
     trace_builder.op_sub(8, 9, 9, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace,
                                        FF(uint256_t::from_uint128(a)),
@@ -1461,7 +1461,7 @@ TEST_F(AvmArithmeticTestsU128, subtractionCarry)
 
     trace_builder.op_sub(8, 9, 9, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_sub(trace,
                                        FF(uint256_t::from_uint128(a)),
@@ -1499,7 +1499,7 @@ TEST_F(AvmArithmeticTestsU128, multiplication)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(
         trace, FF(0x38D64BF685FFBLLU), FF(555444333222111LLU), c, FF(0), FF(1), FF(2), AvmMemoryTag::U128);
@@ -1536,7 +1536,7 @@ TEST_F(AvmArithmeticTestsU128, multiplicationOverflow)
 
     trace_builder.op_mul(0, 1, 2, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_mul(trace,
                                              FF{ uint256_t::from_uint128(a) },
@@ -1589,7 +1589,7 @@ TEST_F(AvmArithmeticTestsU128, equality)
     trace_builder.set(elem, 1, AvmMemoryTag::U128);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace,
                                             FF(uint256_t::from_uint128(elem)),
@@ -1615,7 +1615,7 @@ TEST_F(AvmArithmeticTestsU128, nonEquality)
     trace_builder.set(b, 1, AvmMemoryTag::U128);
     trace_builder.op_eq(0, 1, 2, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row_index = common_validate_eq(trace,
                                             FF(uint256_t::from_uint128(a)),
@@ -1686,7 +1686,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, divisionFF)
     //                             Memory layout:    [15,315,0,0,0,0,....]
     trace_builder.op_div(1, 0, 2, AvmMemoryTag::FF); // [15,315,21,0,0,0....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto select_row = [](Row r) { return r.avm_main_sel_op_div == FF(1); };
     mutate_ic_in_trace(trace, std::move(select_row), FF(0));
@@ -1703,7 +1703,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, divisionNoZeroButError)
     //                             Memory layout:    [15,315,0,0,0,0,....]
     trace_builder.op_div(1, 0, 2, AvmMemoryTag::FF); // [15,315,21,0,0,0....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -1729,7 +1729,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, divisionByZeroNoError)
     //                             Memory layout:    [15,0,0,0,0,0,....]
     trace_builder.op_div(0, 1, 2, AvmMemoryTag::FF); // [15,0,0,0,0,0....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -1746,7 +1746,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, divisionZeroByZeroNoError)
     //                             Memory layout:    [0,0,0,0,0,0,....]
     trace_builder.op_div(0, 1, 2, AvmMemoryTag::FF); // [0,0,0,0,0,0....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -1767,7 +1767,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, operationWithErrorFlag)
     trace_builder.op_add(0, 1, 4, AvmMemoryTag::FF); // [37,4,11,0,41,0,....]
     trace_builder.return_op(0, 5);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the addition selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_add == FF(1); });
@@ -1784,7 +1784,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, operationWithErrorFlag)
     //                             Memory layout:    [8,4,17,0,0,0,....]
     trace_builder.op_sub(2, 0, 1, AvmMemoryTag::FF); // [8,9,17,0,0,0....]
     trace_builder.return_op(0, 3);
-    trace = trace_builder.finalize();
+    trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the subtraction selector
     row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_sub == FF(1); });
@@ -1801,7 +1801,7 @@ TEST_F(AvmArithmeticNegativeTestsFF, operationWithErrorFlag)
     //                             Memory layout:    [5,0,20,0,0,0,....]
     trace_builder.op_mul(2, 0, 1, AvmMemoryTag::FF); // [5,100,20,0,0,0....]
     trace_builder.return_op(0, 3);
-    trace = trace_builder.finalize();
+    trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the multiplication selector
     row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_mul == FF(1); });
@@ -63,7 +63,7 @@ std::vector<Row> gen_mutated_trace_not(FF const& a, FF const& c_mutated, avm_tra
     trace_builder.set(uint128_t{ a }, 0, tag);
     trace_builder.op_not(0, 1, tag);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto select_row = [](Row r) { return r.avm_main_sel_op_not == FF(1); };
     mutate_ic_in_trace(trace, select_row, c_mutated, true);
@@ -114,7 +114,7 @@ TEST_F(AvmBitwiseTestsU8, BitwiseNot)
     trace_builder.set(1, 0, AvmMemoryTag::U8);    // Memory Layout: [1,0,0,...]
     trace_builder.op_not(0, 1, AvmMemoryTag::U8); // [1,254,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_op_not(trace, FF(1), FF(254), FF(0), FF(1), AvmMemoryTag::U8);
 
@@ -127,7 +127,7 @@ TEST_F(AvmBitwiseTestsU16, BitwiseNot)
     trace_builder.set(512, 0, AvmMemoryTag::U16);  // Memory Layout: [512,0,0,...]
     trace_builder.op_not(0, 1, AvmMemoryTag::U16); // [512,65023,0,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_op_not(trace, FF(512), FF(65'023), FF(0), FF(1), AvmMemoryTag::U16);
 
@@ -140,7 +140,7 @@ TEST_F(AvmBitwiseTestsU32, BitwiseNot)
     trace_builder.set(131'072, 0, AvmMemoryTag::U32); // Memory Layout: [131072,0,0,...]
     trace_builder.op_not(0, 1, AvmMemoryTag::U32);    // [131072,4294836223,,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row = common_validate_op_not(trace, FF(131'072), FF(4'294'836'223LLU), FF(0), FF(1), AvmMemoryTag::U32);
 
@@ -153,7 +153,7 @@ TEST_F(AvmBitwiseTestsU64, BitwiseNot)
     trace_builder.set(0x100000000LLU, 0, AvmMemoryTag::U64); // Memory Layout: [8589934592,0,0,...]
     trace_builder.op_not(0, 1, AvmMemoryTag::U64);           // [8589934592,18446744069414584319,0,0,....]
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     auto alu_row =
         common_validate_op_not(trace, FF(0x100000000LLU), FF(0xfffffffeffffffffLLU), FF(0), FF(1), AvmMemoryTag::U64);
@@ -169,7 +169,7 @@ TEST_F(AvmBitwiseTestsU128, BitwiseNot)
     trace_builder.set(a, 0, AvmMemoryTag::U128);
     trace_builder.op_not(0, 1, AvmMemoryTag::U128);
     trace_builder.return_op(0, 0);
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     uint128_t const res = (uint128_t{ 0xfffbffffffffffff } << 64) + uint128_t{ 0xffffffffffffffff };
     auto alu_row = common_validate_op_not(
@@ -202,7 +202,7 @@ TEST_F(AvmBitwiseNegativeTestsFF, UndefinedOverFF)
     // from the op_not operation.
     trace_builder.return_op(0, 0);
     // Manually update the memory tags in the relevant trace;
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
     // TODO(ilyas): When the SET opcodes applies relational constraints, this will fail
     // we will need to look at a new way of doing this test.
     for (size_t i = 1; i < 4; i++) {
@@ -31,7 +31,7 @@ TEST_F(AvmControlFlowTests, simpleCall)
     trace_builder.internal_call(CALL_ADDRESS);
     trace_builder.halt();
 
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Check call
     {
@@ -70,7 +70,7 @@ TEST_F(AvmControlFlowTests, simpleJump)
     trace_builder.jump(JUMP_ADDRESS);
     trace_builder.halt();
 
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Check jump
     {
@@ -105,7 +105,7 @@ TEST_F(AvmControlFlowTests, simpleCallAndReturn)
     trace_builder.internal_return();
     trace_builder.halt();
 
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Check call
     {
@@ -174,7 +174,7 @@ TEST_F(AvmControlFlowTests, multipleCallsAndReturns)
     trace_builder.internal_return();
     trace_builder.halt();
 
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Check call 1
     {
@@ -27,7 +27,7 @@ void gen_proof_and_validate(std::vector<uint8_t> const& bytecode,
                             std::vector<FF> const& calldata)
 {
     auto circuit_builder = AvmCircuitBuilder();
-    circuit_builder.set_trace(std::move(trace));
+    circuit_builder.set_trace(trace_columns(trace));
     EXPECT_TRUE(circuit_builder.check_circuit());
 
     auto composer = AvmComposer();
@@ -81,7 +81,7 @@ TEST_F(AvmExecutionTests, basicAddReturn)
                 AllOf(Field(&Instruction::op_code, OpCode::RETURN),
                       Field(&Instruction::operands, ElementsAre(VariantWith<uint32_t>(0), VariantWith<uint32_t>(0)))));
 
-    auto trace = Execution::gen_trace(instructions);
+    auto trace = trace_rows(Execution::gen_trace(instructions));
     gen_proof_and_validate(bytecode, std::move(trace), {});
 }
 
@@ -135,7 +135,7 @@ TEST_F(AvmExecutionTests, setAndSubOpcodes)
                                         VariantWith<uint32_t>(51),
                                         VariantWith<uint32_t>(1)))));
 
-    auto trace = Execution::gen_trace(instructions);
+    auto trace = trace_rows(Execution::gen_trace(instructions));
 
     // Find the first row enabling the subtraction selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_sub == 1; });
@@ -207,7 +207,7 @@ TEST_F(AvmExecutionTests, powerWithMulOpcodes)
                 AllOf(Field(&Instruction::op_code, OpCode::RETURN),
                       Field(&Instruction::operands, ElementsAre(VariantWith<uint32_t>(0), VariantWith<uint32_t>(0)))));
 
-    auto trace = Execution::gen_trace(instructions);
+    auto trace = trace_rows(Execution::gen_trace(instructions));
 
     // Find the first row enabling the multiplication selector and pc = 13
     auto row = std::ranges::find_if(
@@ -264,7 +264,7 @@ TEST_F(AvmExecutionTests, simpleInternalCall)
     // INTERNALRETURN
     EXPECT_EQ(instructions.at(5).op_code, OpCode::INTERNALRETURN);
 
-    auto trace = Execution::gen_trace(instructions);
+    auto trace = trace_rows(Execution::gen_trace(instructions));
 
     // Expected sequence of PCs during execution
     std::vector<FF> pc_sequence{ 0, 1, 4, 5, 2, 3 };
@@ -340,7 +340,7 @@ TEST_F(AvmExecutionTests, nestedInternalCalls)
         EXPECT_EQ(instructions.at(i).op_code, opcode_sequence.at(i));
     }
 
-    auto trace = Execution::gen_trace(instructions);
+    auto trace = trace_rows(Execution::gen_trace(instructions));
 
     // Expected sequence of PCs during execution
     std::vector<FF> pc_sequence{ 0, 1, 2, 8, 6, 7, 9, 10, 4, 5, 11, 3 };
@@ -405,7 +405,7 @@ TEST_F(AvmExecutionTests, jumpAndCalldatacopy)
                 AllOf(Field(&Instruction::op_code, OpCode::JUMP),
                       Field(&Instruction::operands, ElementsAre(VariantWith<uint32_t>(3)))));
 
-    auto trace = Execution::gen_trace(instructions, std::vector<FF>{ 13, 156 });
+    auto trace = trace_rows(Execution::gen_trace(instructions, std::vector<FF>{ 13, 156 }));
 
     // Expected sequence of PCs during execution
     std::vector<FF> pc_sequence{ 0, 1, 3, 4 };
@@ -35,7 +35,7 @@ TEST_F(AvmMemoryTests, mismatchedTag)
 
     trace_builder.op_add(0, 1, 4, AvmMemoryTag::U8);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the addition selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_add == FF(1); });
@@ -83,7 +83,7 @@ TEST_F(AvmMemoryTests, mLastAccessViolation)
     //                           Memory layout:     [4,9,0,0,0,0,....]
     trace_builder.op_sub(1, 0, 2, AvmMemoryTag::U8); // [4,9,5,0,0,0.....]
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the row with subtraction operation
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_sub == FF(1); });
@@ -113,7 +113,7 @@ TEST_F(AvmMemoryTests, readWriteConsistencyValViolation)
     //                           Memory layout:      [4,9,0,0,0,0,....]
     trace_builder.op_mul(1, 0, 2, AvmMemoryTag::U8); // [4,9,36,0,0,0.....]
     trace_builder.return_op(2, 1);                   // Return single memory word at position 2 (36)
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the row with multiplication operation
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_mul == FF(1); });
@@ -143,7 +143,7 @@ TEST_F(AvmMemoryTests, readWriteConsistencyTagViolation)
     //                           Memory layout:      [4,9,0,0,0,0,....]
     trace_builder.op_mul(1, 0, 2, AvmMemoryTag::U8); // [4,9,36,0,0,0.....]
     trace_builder.return_op(2, 1);                   // Return single memory word at position 2 (36)
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the row with multiplication operation
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_mul == FF(1); });
@@ -168,7 +168,7 @@ TEST_F(AvmMemoryTests, readWriteConsistencyTagViolation)
 TEST_F(AvmMemoryTests, readUninitializedMemoryViolation)
 {
     trace_builder.return_op(1, 1); // Return single memory word at position 1
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     trace[1].avm_mem_m_val = 9;
 
@@ -183,7 +183,7 @@ TEST_F(AvmMemoryTests, mismatchedTagErrorViolation)
 
     trace_builder.op_sub(0, 1, 4, AvmMemoryTag::U8);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the subtraction selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_sub == FF(1); });
@@ -217,7 +217,7 @@ TEST_F(AvmMemoryTests, consistentTagNoErrorViolation)
 
     trace_builder.op_div(0, 1, 4, AvmMemoryTag::FF);
     trace_builder.halt();
-    auto trace = trace_builder.finalize();
+    auto trace = trace_rows(trace_builder.finalize());
 
     // Find the first row enabling the division selector
     auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.avm_main_sel_op_div == FF(1); });
@@ -3,6 +3,44 @@
 using namespace bb;
 
 namespace tests_avm {
+/**
+ * @brief Helper routine reading the rows of a trace back from its columns, so that tests can look them up and
+ *        mutate them. The shifted values are not read.
+ *
+ * @param columns The columns of the execution trace
+ */
+std::vector<Row> trace_rows(TraceColumns columns)
+{
+    std::vector<Row> rows(columns.get_polynomial_size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        for (auto [value, column] : zip_view(rows[i].get_unshifted(), columns.get_unshifted())) {
+            value = column[i];
+        }
+    }
+    return rows;
+}
+
+/**
+ * @brief Helper routine writing the rows of a trace into columns, the inverse of trace_rows.
+ *
+ * @param rows The execution trace
+ */
+TraceColumns trace_columns(std::vector<Row> const& rows)
+{
+    TraceColumns columns;
+    for (auto& column : columns.get_unshifted()) {
+        column = Flavor::Polynomial(rows.size());
+    }
+    for (size_t i = 0; i < rows.size(); i++) {
+        // The entities of a row are only exposed through non-const getters
+        Row row = rows[i];
+        for (auto [column, value] : zip_view(columns.get_unshifted(), row.get_unshifted())) {
+            column[i] = value;
+        }
+    }
+    return columns;
+}
+
 /**
  * @brief Helper routine proving and verifying a proof based on the supplied trace
  *
@@ -11,7 +49,7 @@ namespace tests_avm {
 void validate_trace_proof(std::vector<Row>&& trace)
 {
     auto circuit_builder = AvmCircuitBuilder();
-    circuit_builder.set_trace(std::move(trace));
+    circuit_builder.set_trace(trace_columns(trace));
 
     EXPECT_TRUE(circuit_builder.check_circuit());
 
@@ -25,7 +63,7 @@ void validate_trace_proof(std::vector<Row>&& trace)
     EXPECT_TRUE(verified);
 
     if (!verified) {
-        avm_trace::log_avm_trace(circuit_builder.rows, 0, 10);
+        avm_trace::log_avm_trace(trace, 0, 10);
     }
 };
 
@@ -14,8 +14,11 @@ namespace tests_avm {
 
 using Flavor = bb::AvmFlavor;
 using FF = Flavor::FF;
-using Row = bb::AvmFullRow<bb::fr>;
+using Row = bb::avm_trace::Row;
+using TraceColumns = bb::avm_trace::TraceColumns;
 
+std::vector<Row> trace_rows(TraceColumns columns);
+TraceColumns trace_columns(std::vector<Row> const& rows);
 void validate_trace_proof(std::vector<Row>&& trace);
 void mutate_ic_in_trace(std::vector<Row>& trace,
                         std::function<bool(Row)>&& selectRow,